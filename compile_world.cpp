@@ -0,0 +1,57 @@
+/**
+ * @file compile_world.cpp
+ * @brief Offline compiler from a text world description to a world image.
+ *
+ * Usage: CompileWorld <input.world> <output.advworld>
+ * Validation issues are printed as warnings and the image is still written,
+ * unless an exit names a room that does not exist: then nothing is written.
+ */
+
+#include "lib/Map.hpp"             // for Map
+#include "lib/WorldImage.hpp"      // for write_world_image
+#include "lib/WorldText.hpp"       // for read_world
+#include "lib/WorldValidator.hpp"  // for validate_world, IssueKind
+
+#include <exception>  // for exception
+#include <fstream>    // for ifstream, ofstream
+#include <iostream>   // for cerr
+#include <iterator>   // for istreambuf_iterator
+#include <string>     // for string
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <input.world> <output.advworld>\n";
+    return 2;
+  }
+  try {
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input) {
+      std::cerr << "Cannot read " << argv[1] << '\n';
+      return 1;
+    }
+    const std::string text{std::istreambuf_iterator<char>(input),
+                           std::istreambuf_iterator<char>()};
+    const auto source = adv_sk::read_world(text);
+    const auto report =
+        adv_sk::validate_world(source.rooms, source.connections);
+    if (!report.ok()) {
+      std::cerr << report.describe();
+    }
+    // The Map cannot link an exit to a room that does not exist.
+    if (report.count(adv_sk::IssueKind::DanglingExit) != 0 ||
+        report.count(adv_sk::IssueKind::UnknownRoom) != 0) {
+      std::cerr << "Not compiled: exits name rooms that do not exist\n";
+      return 1;
+    }
+
+    const adv_sk::Map map(source.rooms, source.connections);
+    std::ofstream output(argv[2], std::ios::binary | std::ios::trunc);
+    adv_sk::write_world_image(map, output);
+    std::cerr << "Compiled " << map.size() << " rooms into " << argv[2]
+              << '\n';
+  } catch (const std::exception& error) {
+    std::cerr << error.what() << '\n';
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+// ActionJournal benchmarks
+
+#include "ActionJournal.hpp"
+
+#include "ActionScript.hpp"       // for parse_script
+#include "Map.hpp"                // for create_map
+#include "Simulator.hpp"          // for Simulator
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstdint>  // for int64_t
+
+namespace adv_sk::bench {
+
+  namespace {
+    /// `rounds` times the same six actions, ending back in the hall.
+    ActionJournal make_journal(std::int64_t rounds) {
+      const auto round = parse_script(
+          "investigate; take golden chalice; move North; inventory; "
+          "move South; drop golden chalice");
+      ActionJournal journal;
+      for (std::int64_t index = 0; index < rounds; ++index) {
+        for (const auto& step : round) {
+          if (step.action == Action::Move) {
+            journal.record(step.action, step.direction);
+          } else if (!step.item_name.empty()) {
+            journal.record(step.action, step.item_name);
+          } else {
+            journal.record(step.action);
+          }
+        }
+      }
+      return journal;
+    }
+
+    void BM_JournalDecode(benchmark::State& state) {
+      const auto journal = make_journal(state.range(0));
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(journal.steps());
+      }
+      state.SetItemsProcessed(state.iterations() *
+                              static_cast<std::int64_t>(journal.size()));
+    }
+    BENCHMARK(BM_JournalDecode)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+    /// Decoding and playing the journal against a fresh map.
+    void BM_JournalReplay(benchmark::State& state) {
+      const auto journal = make_journal(state.range(0));
+      for (auto _ : state) {
+        Simulator replay([] { return create_map(); }, journal.steps());
+        benchmark::DoNotOptimize(replay.run(1));
+      }
+      state.SetItemsProcessed(state.iterations() *
+                              static_cast<std::int64_t>(journal.size()));
+    }
+    BENCHMARK(BM_JournalReplay)->Arg(100'000)->Unit(benchmark::kMillisecond);
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,222 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "ActionJournal.hpp"
+
+#include "OutputQueue.hpp"  // for OutputQueue
+
+#include <algorithm>  // for max
+#include <cstdint>    // for uint8_t
+#include <fstream>    // for ifstream, ofstream
+#include <iterator>   // for istreambuf_iterator
+#include <stdexcept>  // for runtime_error, logic_error
+#include <utility>    // for move
+
+#include <fcntl.h>   // for open, O_WRONLY, O_CREAT, O_TRUNC, O_APPEND
+#include <unistd.h>  // for close
+
+namespace adv_sk {
+
+  namespace {
+    bool takes_name(Action action) {
+      return action == Action::TakeItem || action == Action::UseItem ||
+             action == Action::DropItem || action == Action::TravelTo;
+    }
+
+    /// Walks the records after the header, checking each as it goes.
+    class RecordReader {
+     public:
+      explicit RecordReader(std::string_view bytes) : _bytes(bytes) {
+        if (!_bytes.starts_with(ActionJournal::HEADER)) {
+          throw std::runtime_error("Not an action journal");
+        }
+        _position = ActionJournal::HEADER.size();
+      }
+
+      [[nodiscard]] bool done() const {
+        return _position == _bytes.size();
+      }
+
+      ScriptStep next() {
+        ScriptStep step{.action = static_cast<Action>(next_byte())};
+        if (step.action > Action::Quit) {
+          throw std::runtime_error("Corrupt journal: unknown action");
+        }
+        if (step.action == Action::Move) {
+          step.direction = static_cast<Direction>(next_byte());
+          if (step.direction > Direction::West) {
+            throw std::runtime_error("Corrupt journal: unknown direction");
+          }
+        } else if (takes_name(step.action)) {
+          auto& name = step.action == Action::TravelTo ? step.room_name
+                                                       : step.item_name;
+          name = next_name();
+        }
+        return step;
+      }
+
+     private:
+      std::uint8_t next_byte() {
+        if (done()) {
+          throw std::runtime_error("Corrupt journal: truncated record");
+        }
+        return static_cast<std::uint8_t>(_bytes[_position++]);
+      }
+
+      std::string_view next_name() {
+        std::size_t length = 0;
+        for (unsigned shift = 0;; shift += 7) {
+          const auto byte = next_byte();
+          if (shift > 28) {
+            throw std::runtime_error("Corrupt journal: bad name length");
+          }
+          length |= static_cast<std::size_t>(byte & 0x7FU) << shift;
+          if ((byte & 0x80U) == 0) {
+            break;
+          }
+        }
+        if (length > _bytes.size() - _position) {
+          throw std::runtime_error("Corrupt journal: truncated name");
+        }
+        const auto name = _bytes.substr(_position, length);
+        _position += length;
+        return name;
+      }
+
+      std::string_view _bytes;
+      std::size_t _position{0};
+    };
+  }  // namespace
+
+  struct ActionJournal::File {
+    /// Closes the file once the queue, declared after it, is drained.
+    struct Descriptor {
+      explicit Descriptor(const std::filesystem::path& path)
+          : value(::open(path.c_str(),
+                         O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC,
+                         0644)) {
+        if (value < 0) {
+          throw std::runtime_error("Cannot create journal: " + path.string());
+        }
+      }
+
+      Descriptor(const Descriptor&) = delete;
+      Descriptor& operator=(const Descriptor&) = delete;
+      Descriptor(Descriptor&&) = delete;
+      Descriptor& operator=(Descriptor&&) = delete;
+
+      ~Descriptor() {
+        close(value);
+      }
+
+      int value;
+    };
+
+    explicit File(const std::filesystem::path& path)
+        : descriptor(path), queue(descriptor.value, FILE_BUFFERS) {
+    }
+
+    Descriptor descriptor;
+    OutputQueue queue;
+  };
+
+  ActionJournal::ActionJournal(std::size_t capacity) {
+    _bytes.reserve(HEADER.size() + capacity);
+    _bytes.append(HEADER);
+  }
+
+  ActionJournal ActionJournal::create(const std::filesystem::path& path,
+                                      std::size_t capacity) {
+    ActionJournal journal(capacity);
+    journal._file = std::make_unique<File>(path);
+    journal._spill_size = std::max<std::size_t>(capacity, 1);
+    return journal;
+  }
+
+  ActionJournal::ActionJournal(ActionJournal&& other) noexcept
+      : _bytes(std::move(other._bytes)),
+        _records(other._records),
+        _spill_size(other._spill_size),
+        _file(std::move(other._file)) {
+  }
+
+  ActionJournal::~ActionJournal() {
+    // The queue writes out what it holds before the file is closed.
+    if (_file) {
+      spill();
+    }
+  }
+
+  ActionJournal ActionJournal::load(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      throw std::runtime_error("Cannot open journal: " + path.string());
+    }
+    return from_bytes(std::string(std::istreambuf_iterator<char>(file),
+                                  std::istreambuf_iterator<char>()));
+  }
+
+  ActionJournal ActionJournal::from_bytes(std::string bytes) {
+    RecordReader reader(bytes);
+    std::size_t records = 0;
+    for (; !reader.done(); ++records) {
+      static_cast<void>(reader.next());
+    }
+    ActionJournal journal(0);
+    journal._bytes = std::move(bytes);
+    journal._records = records;
+    return journal;
+  }
+
+  void ActionJournal::record_long(Action action, std::string_view name) {
+    _bytes.push_back(static_cast<char>(action));
+    for (auto length = name.size();; length >>= 7U) {
+      if (length < 0x80U) {
+        _bytes.push_back(static_cast<char>(length));
+        break;
+      }
+      _bytes.push_back(static_cast<char>((length & 0x7FU) | 0x80U));
+    }
+    _bytes.append(name);
+    recorded();
+  }
+
+  void ActionJournal::spill() {
+    if (!_bytes.empty()) {
+      _file->queue.push_bytes(_bytes);
+      _bytes.clear();
+    }
+  }
+
+  void ActionJournal::flush() {
+    if (_file) {
+      spill();
+      _file->queue.flush();
+    }
+  }
+
+  std::vector<ScriptStep> ActionJournal::steps() const {
+    if (_file) {
+      throw std::logic_error("Journal is in a file; load() it");
+    }
+    std::vector<ScriptStep> steps;
+    steps.reserve(_records);
+    for (RecordReader reader(_bytes); !reader.done();) {
+      steps.push_back(reader.next());
+    }
+    return steps;
+  }
+
+  void ActionJournal::save(const std::filesystem::path& path) const {
+    if (_file) {
+      throw std::logic_error("Journal is already in a file");
+    }
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(_bytes.data(), static_cast<std::streamsize>(_bytes.size()));
+    if (!file) {
+      throw std::runtime_error("Cannot write journal: " + path.string());
+    }
+  }
+
+}  // namespace adv_sk
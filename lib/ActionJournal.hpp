@@ -0,0 +1,141 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "ActionScript.hpp"   // for ScriptStep
+#include "Direction.hpp"      // for Direction
+#include "IInputHandler.hpp"  // for Action
+
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <filesystem>   // for path
+#include <limits>       // for numeric_limits
+#include <memory>       // for unique_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  /**
+   * @brief Append-only binary record of the actions a game handled.
+   *
+   * Each record is the action's byte, followed by the direction's byte for
+   * Action::Move or by a varint length and the name for item and travel
+   * actions; the journal starts with a short header. Recording appends a
+   * few bytes to a buffer reserved up front, so it costs the action next to
+   * nothing. steps() turns a journal back into a script, which Simulator
+   * replays against a fresh map without any console I/O.
+   *
+   * A journal made by create() keeps no more than that buffer in memory:
+   * once it is full its bytes are handed to an OutputQueue, whose shared
+   * writer threads append them to the file, and recording goes on at once.
+   * Only a writer FILE_BUFFERS buffers behind makes recording wait. A
+   * failed write never reaches record(); flush() throws it.
+   */
+  class ActionJournal {
+   public:
+    static constexpr std::string_view HEADER = "ADVJ\x01";
+    static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+    /// Full buffers of create()'s journal that may wait to be written.
+    static constexpr std::size_t FILE_BUFFERS = 4;
+
+    explicit ActionJournal(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /// Starts a journal in a new file at `path`, replacing any there;
+    /// throws std::runtime_error if it cannot be created.
+    static ActionJournal create(const std::filesystem::path& path,
+                                std::size_t capacity = DEFAULT_CAPACITY);
+
+    ActionJournal(const ActionJournal&) = delete;
+    ActionJournal& operator=(const ActionJournal&) = delete;
+    ActionJournal(ActionJournal&& other) noexcept;
+    ActionJournal& operator=(ActionJournal&&) = delete;
+
+    /// Writes out what create()'s journal still holds and closes the file.
+    ~ActionJournal();
+
+    /// Reads a saved journal; throws std::runtime_error if it is not one.
+    static ActionJournal load(const std::filesystem::path& path);
+
+    /// Takes encoded records; throws std::runtime_error if they are corrupt.
+    static ActionJournal from_bytes(std::string bytes);
+
+    /// An action without an argument.
+    void record(Action action) {
+      _bytes.push_back(static_cast<char>(action));
+      recorded();
+    }
+
+    void record(Action action, Direction direction) {
+      const std::array<char, 2> record{static_cast<char>(action),
+                                       static_cast<char>(direction)};
+      _bytes.append(record.data(), record.size());
+      recorded();
+    }
+
+    /// An item or travel action and the name the player gave.
+    void record(Action action, std::string_view name) {
+      if (name.size() < 0x80U) {
+        const std::array<char, 2> record{static_cast<char>(action),
+                                         static_cast<char>(name.size())};
+        _bytes.append(record.data(), record.size()).append(name);
+        recorded();
+      } else {
+        record_long(action, name);
+      }
+    }
+
+    /// The actions in the order they were recorded; throws
+    /// std::logic_error for a journal written to a file, which load() reads.
+    [[nodiscard]] std::vector<ScriptStep> steps() const;
+
+    /// Writes the whole journal, header included, to `path`; throws
+    /// std::logic_error for a journal already written to a file.
+    void save(const std::filesystem::path& path) const;
+
+    /// Appends the records held in memory to create()'s file and waits
+    /// until they are written; throws std::runtime_error if any write
+    /// failed. Nothing to do for other journals.
+    void flush();
+
+    /// Records not yet written out; for a journal in memory, all of them.
+    [[nodiscard]] std::string_view bytes() const {
+      return _bytes;
+    }
+
+    [[nodiscard]] std::size_t size() const {
+      return _records;
+    }
+
+    [[nodiscard]] bool empty() const {
+      return _records == 0;
+    }
+
+   private:
+    /// The file create() opened and the queue appending to it.
+    struct File;
+
+    void recorded() {
+      ++_records;
+      if (_bytes.size() >= _spill_size) {
+        spill();
+      }
+    }
+
+    /// record() for names whose length takes more than one byte.
+    void record_long(Action action, std::string_view name);
+
+    /// Hands the bytes held in memory to the file's queue.
+    void spill();
+
+    std::string _bytes{};
+    std::size_t _records{0};
+    /// Held bytes that go to the file; never reached without one.
+    std::size_t _spill_size{std::numeric_limits<std::size_t>::max()};
+    std::unique_ptr<File> _file{};
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,144 @@
+// ActionJournal unit tests
+
+#include "ActionJournal.hpp"
+
+#include "ActionScript.hpp"          // for parse_script, ScriptStep
+#include "Direction.hpp"             // for Direction
+#include "Game.hpp"                  // for BasicGame
+#include "HeadlessInputHandler.hpp"  // for HeadlessInputHandler
+#include "IInputHandler.hpp"         // for Action
+#include "IMap.hpp"                  // for IMap
+#include "Map.hpp"                   // for create_map
+#include "Player.hpp"                // for Player
+#include "Simulator.hpp"             // for Simulator, OutputMode
+#include "gtest/gtest.h"             // for TEST, EXPECT_EQ
+
+#include <filesystem>  // for temp_directory_path, remove, file_size
+#include <memory>      // for make_unique
+#include <stdexcept>   // for runtime_error, logic_error
+#include <string>      // for string
+#include <vector>      // for vector
+
+namespace adv_sk::test {
+
+  TEST(ActionJournal, recordsStepsInOrder) {
+    ActionJournal journal;
+    journal.record(Action::Investigate);
+    journal.record(Action::Move, Direction::East);
+    journal.record(Action::TakeItem, "golden chalice");
+    journal.record(Action::TravelTo, "Armoury");
+    journal.record(Action::Quit);
+
+    EXPECT_EQ(journal.size(), 5);
+    // Header, 1 + 2 + (2 + 14) + (2 + 7) + 1 bytes of records.
+    EXPECT_EQ(journal.bytes().size(), ActionJournal::HEADER.size() + 29);
+    EXPECT_EQ(journal.steps(),
+              (std::vector<ScriptStep>{
+                  {.action = Action::Investigate},
+                  {.action = Action::Move, .direction = Direction::East},
+                  {.action = Action::TakeItem, .item_name = "golden chalice"},
+                  {.action = Action::TravelTo, .room_name = "Armoury"},
+                  {.action = Action::Quit},
+              }));
+  }
+
+  TEST(ActionJournal, longNamesTakeSeveralLengthBytes) {
+    const std::string name(300, 'n');
+    ActionJournal journal;
+    journal.record(Action::DropItem, name);
+
+    EXPECT_EQ(journal.bytes().size(), ActionJournal::HEADER.size() + 303);
+    EXPECT_EQ(journal.steps().front().item_name, name);
+  }
+
+  TEST(ActionJournal, rejectsBytesThatAreNotAJournal) {
+    EXPECT_THROW(ActionJournal::from_bytes("ADV"), std::runtime_error);
+
+    ActionJournal journal;
+    journal.record(Action::UseItem, "torch");
+    std::string truncated(journal.bytes());
+    truncated.pop_back();
+    EXPECT_THROW(ActionJournal::from_bytes(truncated), std::runtime_error);
+
+    std::string unknown(ActionJournal::HEADER);
+    unknown.push_back('\x7F');
+    EXPECT_THROW(ActionJournal::from_bytes(unknown), std::runtime_error);
+  }
+
+  TEST(ActionJournal, savesAndLoads) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "adv_sk_journal.test";
+    ActionJournal journal;
+    journal.record(Action::Move, Direction::North);
+    journal.record(Action::DisplayInventory);
+    journal.save(path);
+
+    const auto loaded = ActionJournal::load(path);
+    std::filesystem::remove(path);
+    EXPECT_EQ(loaded.size(), 2);
+    EXPECT_EQ(loaded.bytes(), journal.bytes());
+    EXPECT_THROW(ActionJournal::load(path), std::runtime_error);
+  }
+
+  TEST(ActionJournal, createdJournalAppendsToItsFile) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "adv_sk_appended.test";
+    {
+      auto journal = ActionJournal::create(path, 8);
+      journal.record(Action::Investigate);
+      EXPECT_EQ(journal.bytes().size(), ActionJournal::HEADER.size() + 1);
+
+      journal.record(Action::TakeItem, "golden chalice");
+      EXPECT_TRUE(journal.bytes().empty());
+      journal.record(Action::Move, Direction::South);
+      journal.flush();
+      EXPECT_EQ(std::filesystem::file_size(path),
+                ActionJournal::HEADER.size() + 19);
+
+      journal.record(Action::Quit);
+      EXPECT_THROW(static_cast<void>(journal.steps()), std::logic_error);
+    }
+
+    const auto loaded = ActionJournal::load(path);
+    std::filesystem::remove(path);
+    EXPECT_EQ(loaded.size(), 4);
+    EXPECT_EQ(loaded.steps(),
+              (std::vector<ScriptStep>{
+                  {.action = Action::Investigate},
+                  {.action = Action::TakeItem, .item_name = "golden chalice"},
+                  {.action = Action::Move, .direction = Direction::South},
+                  {.action = Action::Quit},
+              }));
+    EXPECT_THROW(ActionJournal::create("/nonexistent/journal"),
+                 std::runtime_error);
+  }
+
+  TEST(ActionJournal, failedFileWritesOnlySurfaceInFlush) {
+    auto journal = ActionJournal::create("/dev/full", 8);
+    for (int round = 0; round < 100; ++round) {
+      EXPECT_NO_THROW(journal.record(Action::TakeItem, "golden chalice"));
+    }
+    EXPECT_THROW(journal.flush(), std::runtime_error);
+  }
+
+  TEST(ActionJournal, replayReproducesTheSession) {
+    const auto script = parse_script(
+        "investigate; take golden chalice; move North; investigate; "
+        "inventory; travel GrandHall; drop golden chalice; use nothing; quit");
+    ActionJournal journal;
+    std::string played;
+    BasicGame<IMap, Player, HeadlessInputHandler> game{
+        create_map(), std::make_unique<Player>(),
+        std::make_unique<HeadlessInputHandler>(script, &played)};
+    game.set_journal(&journal);
+    game.start();
+
+    const auto loaded = ActionJournal::from_bytes(std::string(journal.bytes()));
+    EXPECT_EQ(loaded.steps(), script);
+    Simulator replay([] { return create_map(); }, loaded.steps(),
+                     OutputMode::Collect);
+    EXPECT_EQ(replay.run(1).actions, script.size());
+    EXPECT_EQ(replay.transcript(), played);
+  }
+
+}  // namespace adv_sk::test
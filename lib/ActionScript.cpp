@@ -0,0 +1,62 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "ActionScript.hpp"
+
+#include "CommandParser.hpp"  // for parse_command, trim, CommandError
+
+#include <stdexcept>    // for runtime_error
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  namespace {
+    ScriptStep parse_step(std::string_view step) {
+      const auto command = parse_command(step);
+      if (command.error == CommandError::UnknownCommand) {
+        throw std::runtime_error("Unknown script command: " +
+                                 std::string(step.substr(0, step.find(' '))));
+      }
+      ScriptStep parsed{.action = command.action};
+      switch (command.action) {
+        case Action::Move:
+          if (!command.ok() || !command.direction.has_value()) {
+            throw std::runtime_error("Unknown direction");
+          }
+          parsed.direction = command.direction.value();
+          break;
+        case Action::TakeItem:
+        case Action::UseItem:
+        case Action::DropItem:
+          parsed.item_name = std::string(command.argument);
+          break;
+        case Action::TravelTo:
+          parsed.room_name = RoomName(command.argument);
+          break;
+        case Action::Investigate:
+        case Action::DisplayInventory:
+        case Action::Quit:
+          break;
+      }
+      return parsed;
+    }
+  }  // namespace
+
+  std::vector<ScriptStep> parse_script(std::string_view script) {
+    std::vector<ScriptStep> steps;
+    while (!script.empty()) {
+      const auto end = script.find_first_of(";\n");
+      const auto step = trim(script.substr(0, end));
+      if (!step.empty()) {
+        steps.push_back(parse_step(step));
+      }
+      script.remove_prefix(end == std::string_view::npos ? script.size()
+                                                         : end + 1);
+    }
+    return steps;
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,38 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"      // for Direction
+#include "IInputHandler.hpp"  // for Action
+#include "Types.hpp"          // for RoomName
+
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  /// One scripted player action with the argument the action asks for.
+  struct ScriptStep {
+    Action action{Action::Quit};
+    Direction direction{Direction::North};
+    std::string item_name{};
+    RoomName room_name{};
+
+    bool operator==(const ScriptStep& step) const = default;
+  };
+
+  /**
+   * @brief Parses a compact action script.
+   *
+   * Steps are separated by newlines or ';'. Each step is one of
+   * "move <Direction>", "investigate", "take <item>", "use <item>",
+   * "drop <item>", "travel <room>", "inventory" or "quit", or any alias
+   * parse_command() accepts; blank steps are skipped. Throws
+   * std::runtime_error on an unknown command or direction.
+   */
+  std::vector<ScriptStep> parse_script(std::string_view script);
+
+}  // namespace adv_sk
@@ -0,0 +1,62 @@
+// ActionScript unit tests
+
+#include "ActionScript.hpp"
+
+#include "Direction.hpp"      // for Direction
+#include "IInputHandler.hpp"  // for Action
+#include "gtest/gtest.h"      // for TEST, EXPECT_EQ
+
+#include <stdexcept>  // for runtime_error
+#include <vector>     // for vector
+
+namespace adv_sk::test {
+
+  TEST(ActionScript, parsesEveryCommand) {
+    const auto steps = parse_script(
+        "move North; investigate; take golden chalice; use golden chalice;"
+        "drop rusty sword; travel Armoury; inventory; quit");
+    const std::vector<ScriptStep> expected{
+        {.action = Action::Move, .direction = Direction::North},
+        {.action = Action::Investigate},
+        {.action = Action::TakeItem, .item_name = "golden chalice"},
+        {.action = Action::UseItem, .item_name = "golden chalice"},
+        {.action = Action::DropItem, .item_name = "rusty sword"},
+        {.action = Action::TravelTo, .room_name = "Armoury"},
+        {.action = Action::DisplayInventory},
+        {.action = Action::Quit},
+    };
+    EXPECT_EQ(steps, expected);
+  }
+
+  TEST(ActionScript, acceptsNewlinesAndSkipsBlankSteps) {
+    const auto steps = parse_script("\n  move South \r\n;;\ninvestigate\n");
+    ASSERT_EQ(steps.size(), 2);
+    EXPECT_EQ(steps[0].direction, Direction::South);
+    EXPECT_EQ(steps[1].action, Action::Investigate);
+  }
+
+  TEST(ActionScript, acceptsAliases) {
+    const auto steps = parse_script("n; go west; get lamp; inv; q");
+    const std::vector<ScriptStep> expected{
+        {.action = Action::Move, .direction = Direction::North},
+        {.action = Action::Move, .direction = Direction::West},
+        {.action = Action::TakeItem, .item_name = "lamp"},
+        {.action = Action::DisplayInventory},
+        {.action = Action::Quit},
+    };
+    EXPECT_EQ(steps, expected);
+  }
+
+  TEST(ActionScript, emptyScriptHasNoSteps) {
+    EXPECT_TRUE(parse_script("").empty());
+  }
+
+  TEST(ActionScript, unknownCommandThrows) {
+    EXPECT_THROW(parse_script("dance"), std::runtime_error);
+  }
+
+  TEST(ActionScript, unknownDirectionThrows) {
+    EXPECT_THROW(parse_script("move Up"), std::runtime_error);
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,90 @@
+// Global operator new replacement that feeds AllocationCounter
+
+#include "AllocationCounter.hpp"
+
+#include <cstddef>  // for size_t
+#include <cstdlib>  // for malloc, free, aligned_alloc
+#include <new>      // for bad_alloc, align_val_t
+
+namespace {
+  thread_local std::size_t allocations = 0;
+
+  void* counted_alloc(std::size_t size) {
+    ++allocations;
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+      return memory;
+    }
+    throw std::bad_alloc();
+  }
+
+  void* counted_aligned_alloc(std::size_t size, std::align_val_t alignment) {
+    ++allocations;
+    const auto align = static_cast<std::size_t>(alignment);
+    const auto padded = (size + align - 1) / align * align;
+    if (void* memory =
+            std::aligned_alloc(align, padded == 0 ? align : padded)) {
+      return memory;
+    }
+    throw std::bad_alloc();
+  }
+}  // namespace
+
+namespace adv_sk::test {
+
+  std::size_t allocation_count() {
+    return allocations;
+  }
+
+}  // namespace adv_sk::test
+
+// NOLINTBEGIN(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory)
+void* operator new(std::size_t size) {
+  return counted_alloc(size);
+}
+
+void* operator new[](std::size_t size) {
+  return counted_alloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return counted_aligned_alloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return counted_aligned_alloc(size, alignment);
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t /*size*/) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t /*alignment*/) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t /*alignment*/) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t /*size*/,
+                       std::align_val_t /*alignment*/) noexcept {
+  std::free(memory);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory)
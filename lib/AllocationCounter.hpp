@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>  // for size_t
+
+namespace adv_sk::test {
+
+  /// Number of global operator new calls made so far on the calling thread.
+  std::size_t allocation_count();
+
+  /**
+   * @brief Counts heap allocations made on this thread while it is alive.
+   *
+   * Only usable from GameLogicTests, which replaces the global operator new.
+   */
+  class AllocationCounter {
+   public:
+    AllocationCounter() : _start(allocation_count()) {
+    }
+
+    [[nodiscard]] std::size_t count() const {
+      return allocation_count() - _start;
+    }
+
+   private:
+    std::size_t _start;
+  };
+
+}  // namespace adv_sk::test
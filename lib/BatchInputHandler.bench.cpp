@@ -0,0 +1,111 @@
+// BatchInputHandler benchmarks
+
+#include "BatchInputHandler.hpp"
+
+#include "BufferedIO.hpp"         // for LineReader
+#include "Game.hpp"               // for BasicGame
+#include "Map.hpp"                // for Map, create_map
+#include "Player.hpp"             // for Player
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t
+#include <filesystem>   // for path, temp_directory_path, remove
+#include <fstream>      // for ofstream, ifstream
+#include <memory>       // for make_unique
+#include <string>       // for string, getline
+#include <string_view>  // for string_view
+
+#include <fcntl.h>   // for open, O_WRONLY
+#include <unistd.h>  // for close
+
+namespace adv_sk::bench {
+
+  namespace {
+    constexpr std::string_view ROUND =
+        "investigate\n"
+        "take golden chalice\n"
+        "go north\n"
+        "inventory\n"
+        "go south\n"
+        "drop golden chalice\n";
+
+    /// `range(0)` rounds of commands in a temp file, removed afterwards.
+    class Transcript {
+     public:
+      explicit Transcript(const benchmark::State& state)
+          : _path(std::filesystem::temp_directory_path() /
+                  "adv_sk_batch.bench") {
+        std::ofstream out(_path, std::ios::binary);
+        for (auto round = 0; round < state.range(0); ++round) {
+          out << ROUND;
+        }
+      }
+
+      Transcript(const Transcript&) = delete;
+      Transcript& operator=(const Transcript&) = delete;
+      Transcript(Transcript&&) = delete;
+      Transcript& operator=(Transcript&&) = delete;
+
+      ~Transcript() {
+        std::filesystem::remove(_path);
+      }
+
+      [[nodiscard]] const std::filesystem::path& path() const {
+        return _path;
+      }
+
+     private:
+      std::filesystem::path _path;
+    };
+
+    std::int64_t lines(const benchmark::State& state) {
+      return state.iterations() * state.range(0) * 6;
+    }
+
+    /// The interactive handler's way of reading, for comparison.
+    void BM_GetlineLines(benchmark::State& state) {
+      const Transcript transcript(state);
+      for (auto _ : state) {
+        std::ifstream in(transcript.path());
+        std::size_t bytes = 0;
+        for (std::string line; std::getline(in, line);) {
+          bytes += line.size();
+        }
+        benchmark::DoNotOptimize(bytes);
+      }
+      state.SetItemsProcessed(lines(state));
+    }
+    BENCHMARK(BM_GetlineLines)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+    void BM_LineReaderLines(benchmark::State& state) {
+      const Transcript transcript(state);
+      for (auto _ : state) {
+        LineReader reader(transcript.path());
+        std::size_t bytes = 0;
+        while (const auto line = reader.next_line()) {
+          bytes += line->size();
+        }
+        benchmark::DoNotOptimize(bytes);
+      }
+      state.SetItemsProcessed(lines(state));
+    }
+    BENCHMARK(BM_LineReaderLines)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+    /// A whole game played from the transcript, output to /dev/null.
+    void BM_BatchGame(benchmark::State& state) {
+      const Transcript transcript(state);
+      const int sink = ::open("/dev/null", O_WRONLY);
+      for (auto _ : state) {
+        BasicGame<Map, Player, BatchInputHandler> game(
+            create_map(), std::make_unique<Player>(),
+            std::make_unique<BatchInputHandler>(transcript.path(), sink));
+        game.start();
+      }
+      close(sink);
+      state.SetItemsProcessed(lines(state));
+    }
+    BENCHMARK(BM_BatchGame)->Arg(100'000)->Unit(benchmark::kMillisecond);
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,86 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "BatchInputHandler.hpp"
+
+#include "CommandParser.hpp"  // for parse_command, parse_direction, ...
+
+#include <utility>  // for exchange
+
+namespace adv_sk {
+
+  namespace {
+    constexpr std::string_view UNKNOWN_COMMAND = "Command not recognized.\n";
+    constexpr std::string_view WRONG_DIRECTION = "Wrong direction!\n";
+  }  // namespace
+
+  BatchInputHandler::BatchInputHandler(const std::filesystem::path& input,
+                                       int output)
+      : _input(input), _output(output) {
+  }
+
+  BatchInputHandler::BatchInputHandler(int input, int output)
+      : _input(input), _output(output) {
+  }
+
+  Action BatchInputHandler::get_action() {
+    while (const auto line = _input.next_line()) {
+      const auto command = parse_command(line.value());
+      if (command.ok()) {
+        _pending_direction = command.direction;
+        _pending_argument = command.argument;
+        return command.action;
+      }
+      if (command.error != CommandError::Empty) {
+        ++_rejected_lines;
+        _output.write(UNKNOWN_COMMAND);
+      }
+    }
+    return Action::Quit;
+  }
+
+  void BatchInputHandler::provide_directions(DirectionSet /*directions*/) {
+  }
+
+  std::optional<Direction> BatchInputHandler::get_direction() {
+    if (const auto pending = std::exchange(_pending_direction, std::nullopt)) {
+      return pending.value();
+    }
+    while (const auto line = _input.next_line()) {
+      const auto word = trim(line.value());
+      if (const auto direction = parse_direction(word)) {
+        return direction;
+      }
+      if (!word.empty()) {
+        ++_rejected_lines;
+        _output.write(WRONG_DIRECTION);
+      }
+    }
+    return std::nullopt;
+  }
+
+  std::string BatchInputHandler::get_item_name() {
+    return next_argument();
+  }
+
+  std::string BatchInputHandler::get_room_name() {
+    return next_argument();
+  }
+
+  void BatchInputHandler::provide_message(std::string_view message) {
+    _output.write(message);
+    _output.put('\n');
+  }
+
+  void BatchInputHandler::provide_prompt(std::string_view /*prompt*/) {
+  }
+
+  std::string BatchInputHandler::next_argument() {
+    if (!_pending_argument.empty()) {
+      return std::string(std::exchange(_pending_argument, {}));
+    }
+    return std::string(_input.next_line().value_or(""));
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,70 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "BufferedIO.hpp"     // for LineReader, BufferedWriter
+#include "Direction.hpp"      // for Direction, DirectionSet
+#include "IInputHandler.hpp"  // for IInputHandler, Action
+
+#include <cstddef>      // for size_t
+#include <filesystem>   // for path
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace adv_sk {
+
+  /**
+   * @brief Non-interactive IInputHandler for bot transcripts and pipes.
+   *
+   * Takes one command per line in the form parse_command() accepts, from a
+   * memory-mapped file or a pipe read in large blocks; lines are parsed in
+   * place, never copied. No prompts are written and directions are not
+   * listed. The game's messages go, newline-terminated, through a
+   * BufferedWriter. Blank lines are skipped; a line that is not a command
+   * is answered with "Command not recognized." and skipped too, as is one
+   * that is not a direction when a direction is asked for, with "Wrong
+   * direction!". The end of the input is Action::Quit, also when it comes
+   * while a direction is asked for.
+   */
+  class BatchInputHandler final : public IInputHandler {
+   public:
+    BatchInputHandler(const std::filesystem::path& input, int output);
+
+    /// Both descriptors stay owned by the caller.
+    BatchInputHandler(int input, int output);
+
+    Action get_action() override;
+    void provide_directions(DirectionSet directions) override;
+    std::optional<Direction> get_direction() override;
+    std::string get_item_name() override;
+    std::string get_room_name() override;
+    void provide_message(std::string_view message) override;
+    void provide_prompt(std::string_view prompt) override;
+
+    /// Writes out whatever output is still buffered.
+    void flush() {
+      _output.flush();
+    }
+
+    /// Lines read that were not commands or directions.
+    [[nodiscard]] std::size_t rejected_lines() const {
+      return _rejected_lines;
+    }
+
+   private:
+    /// The pending argument, or else the next line.
+    std::string next_argument();
+
+    LineReader _input;
+    BufferedWriter _output;
+    /// Parts of the last command line; they view the reader's buffer,
+    /// which stays put until the next line is read.
+    std::optional<Direction> _pending_direction{};
+    std::string_view _pending_argument{};
+    std::size_t _rejected_lines{0};
+  };
+
+}  // namespace adv_sk
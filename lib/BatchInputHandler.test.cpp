@@ -0,0 +1,143 @@
+// BatchInputHandler unit tests
+
+#include "BatchInputHandler.hpp"
+
+#include "Game.hpp"       // for BasicGame
+#include "Map.hpp"        // for Map, create_map
+#include "Player.hpp"     // for Player
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <filesystem>   // for path, temp_directory_path, remove
+#include <fstream>      // for ofstream, ifstream
+#include <iterator>     // for istreambuf_iterator
+#include <memory>       // for make_unique
+#include <optional>     // for nullopt
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+#include <fcntl.h>   // for open, O_WRONLY, O_CREAT, O_TRUNC
+#include <unistd.h>  // for close
+
+namespace adv_sk::test {
+
+  namespace {
+    /// Plays `commands` from a file and returns what was written.
+    class BatchRun {
+     public:
+      explicit BatchRun(std::string_view commands)
+          : _input(std::filesystem::temp_directory_path() /
+                   "adv_sk_batch_input.test"),
+            _output(std::filesystem::temp_directory_path() /
+                    "adv_sk_batch_output.test") {
+        std::ofstream(_input, std::ios::binary) << commands;
+        _descriptor =
+            ::open(_output.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+      }
+
+      BatchRun(const BatchRun&) = delete;
+      BatchRun& operator=(const BatchRun&) = delete;
+      BatchRun(BatchRun&&) = delete;
+      BatchRun& operator=(BatchRun&&) = delete;
+
+      ~BatchRun() {
+        close(_descriptor);
+        std::filesystem::remove(_input);
+        std::filesystem::remove(_output);
+      }
+
+      [[nodiscard]] const std::filesystem::path& input() const {
+        return _input;
+      }
+
+      [[nodiscard]] int output() const {
+        return _descriptor;
+      }
+
+      [[nodiscard]] std::string written() const {
+        std::ifstream in(_output, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>()};
+      }
+
+     private:
+      std::filesystem::path _input;
+      std::filesystem::path _output;
+      int _descriptor;
+    };
+
+    constexpr std::string_view WELCOME =
+        "You are in the Grand Hall. It is a vast, echoing chamber.\n";
+  }  // namespace
+
+  TEST(BatchInputHandler, playsCommandsWithoutPrompts) {
+    const BatchRun run("investigate\ntake\ngolden chalice\n\ngo north\ni\n");
+    {
+      BasicGame<Map, Player, BatchInputHandler> game(
+          create_map(), std::make_unique<Player>(),
+          std::make_unique<BatchInputHandler>(run.input(), run.output()));
+      game.start();
+    }
+    EXPECT_EQ(run.written(),
+              std::string(WELCOME) +
+                  "Investigating GrandHall\n"
+                  "You search the room. You found a golden chalice!\n\n"
+                  "You take the golden chalice\n\n"
+                  "You are in the Armoury. Racks of dusty weapons line the "
+                  "walls.\n"
+                  "Your inventory contains: golden chalice.\n\n");
+  }
+
+  TEST(BatchInputHandler, inputEndingBeforeTheDirectionQuits) {
+    const BatchRun run("move\n");
+    {
+      BasicGame<Map, Player, BatchInputHandler> game(
+          create_map(), std::make_unique<Player>(),
+          std::make_unique<BatchInputHandler>(run.input(), run.output()));
+      EXPECT_FALSE(game.handle_user_action());
+    }
+    EXPECT_EQ(run.written(), WELCOME);
+  }
+
+  TEST(BatchInputHandler, skipsLinesThatAreNotCommands) {
+    const BatchRun run("dance\nmove\nsouth\n");
+    BatchInputHandler handler(run.input(), run.output());
+    EXPECT_EQ(handler.get_action(), Action::Move);
+    EXPECT_EQ(handler.rejected_lines(), 1);
+    EXPECT_EQ(handler.get_direction(), Direction::South);
+    EXPECT_EQ(handler.get_action(), Action::Quit);
+    handler.flush();
+    EXPECT_EQ(run.written(), "Command not recognized.\n");
+  }
+
+  TEST(BatchInputHandler, skipsLinesThatAreNotDirections) {
+    const BatchRun run("move\nupwards\n\nwest\nmove\n");
+    BatchInputHandler handler(run.input(), run.output());
+    EXPECT_EQ(handler.get_action(), Action::Move);
+    EXPECT_EQ(handler.get_direction(), Direction::West);
+    EXPECT_EQ(handler.rejected_lines(), 1);
+
+    EXPECT_EQ(handler.get_action(), Action::Move);
+    EXPECT_EQ(handler.get_direction(), std::nullopt);
+    EXPECT_EQ(handler.get_action(), Action::Quit);
+    handler.flush();
+    EXPECT_EQ(run.written(), "Wrong direction!\n");
+  }
+
+  TEST(BatchInputHandler, directionLinesAreTrimmed) {
+    const BatchRun run("move\n  north \r\n");
+    BatchInputHandler handler(run.input(), run.output());
+    EXPECT_EQ(handler.get_action(), Action::Move);
+    EXPECT_EQ(handler.get_direction(), Direction::North);
+    EXPECT_EQ(handler.rejected_lines(), 0);
+  }
+
+  TEST(BatchInputHandler, argumentsComeFromTheCommandOrTheNextLine) {
+    const BatchRun run("take rusty sword\ndrop\nlamp");
+    BatchInputHandler handler(run.input(), run.output());
+    EXPECT_EQ(handler.get_action(), Action::TakeItem);
+    EXPECT_EQ(handler.get_item_name(), "rusty sword");
+    EXPECT_EQ(handler.get_action(), Action::DropItem);
+    EXPECT_EQ(handler.get_item_name(), "lamp");
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Direction.hpp"          // for Direction
+#include "IInputHandler.hpp"      // for IInputHandler, Action
+#include "Inventory.hpp"          // for InventoryItem
+#include "Map.hpp"                // for Map
+#include "Room.hpp"               // for Room, NamedConnections
+#include "Types.hpp"              // for RoomName
+#include "benchmark/benchmark.h"  // for internal::Benchmark
+
+#include <cstddef>        // for size_t
+#include <cstdint>        // for int64_t
+#include <memory>         // for unique_ptr, make_unique
+#include <optional>       // for optional
+#include <string>         // for string, to_string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+namespace adv_sk::bench {
+
+  /// World sizes every size-parameterised benchmark runs at.
+  inline constexpr std::size_t MIN_ROOMS = 10;
+  inline constexpr std::size_t MAX_ROOMS = 1'000'000;
+
+  inline RoomName corridor_room_name(std::size_t index) {
+    return index == 0 ? RoomName("GrandHall") : "Room" + std::to_string(index);
+  }
+
+  /// Rooms and authored exits, ready to be handed to the Map constructor.
+  struct WorldDescription {
+    std::vector<Room> rooms{};
+    std::unordered_map<RoomName, NamedConnections> connections{};
+  };
+
+  /**
+   * @brief Describes a north-south corridor of rooms starting at GrandHall.
+   *
+   * Room i leads North to room i + 1; every room holds `items_per_room`
+   * items named "item0", "item1", ...
+   */
+  inline WorldDescription make_corridor_world(std::size_t room_count,
+                                              std::size_t items_per_room) {
+    std::vector<InventoryItem> items;
+    items.reserve(items_per_room);
+    for (std::size_t item = 0; item < items_per_room; ++item) {
+      items.emplace_back("item" + std::to_string(item), "You use it.\n");
+    }
+
+    WorldDescription world;
+    world.rooms.reserve(room_count);
+    world.connections.reserve(room_count);
+    for (std::size_t index = 0; index < room_count; ++index) {
+      world.rooms.emplace_back(corridor_room_name(index),
+                               "You are in a corridor.", items);
+      if (index + 1 < room_count) {
+        world.connections.emplace(
+            corridor_room_name(index),
+            NamedConnections{
+                {Direction::North, corridor_room_name(index + 1)}});
+      }
+    }
+    return world;
+  }
+
+  inline std::unique_ptr<Map> make_corridor_map(std::size_t room_count,
+                                                std::size_t items_per_room) {
+    const auto world = make_corridor_world(room_count, items_per_room);
+    return std::make_unique<Map>(world.rooms, world.connections);
+  }
+
+  /// Upper bound on rooms * items per room, keeping the largest worlds in RAM.
+  inline constexpr std::size_t MAX_WORLD_ITEMS = 4'000'000;
+
+  /**
+   * @brief Registers (rooms, items per room) argument pairs.
+   *
+   * Rooms go from MIN_ROOMS to MAX_ROOMS in powers of ten and inventories
+   * from 1 to 256 items, skipping pairs above MAX_WORLD_ITEMS.
+   */
+  inline void world_and_inventory_sizes(
+      benchmark::internal::Benchmark* bench) {
+    for (auto rooms = MIN_ROOMS; rooms <= MAX_ROOMS; rooms *= 10) {
+      for (const std::size_t items : {1, 16, 256}) {
+        if (rooms * items <= MAX_WORLD_ITEMS) {
+          bench->Args({static_cast<std::int64_t>(rooms),
+                       static_cast<std::int64_t>(items)});
+        }
+      }
+    }
+    bench->ArgNames({"rooms", "items"});
+  }
+
+  /**
+   * @brief IInputHandler that replays a fixed script forever.
+   *
+   * Every step supplies an action plus the direction, item name or room
+   * name that action asks for; all output is discarded.
+   */
+  class ScriptedInputHandler final : public IInputHandler {
+   public:
+    struct Step {
+      Action action{Action::Quit};
+      Direction direction{Direction::North};
+      std::string item_name{};
+      std::string room_name{};
+    };
+
+    explicit ScriptedInputHandler(std::vector<Step> script)
+        : _script(std::move(script)) {
+    }
+
+    Action get_action() override {
+      _current = _next;
+      _next = (_next + 1) % _script.size();
+      return _script[_current].action;
+    }
+
+    void provide_directions(DirectionSet /*directions*/) override {
+    }
+
+    std::optional<Direction> get_direction() override {
+      return _script[_current].direction;
+    }
+
+    std::string get_item_name() override {
+      return _script[_current].item_name;
+    }
+
+    std::string get_room_name() override {
+      return _script[_current].room_name;
+    }
+
+    void provide_message(std::string_view /*message*/) override {
+    }
+
+   private:
+    std::vector<Step> _script;
+    std::size_t _current{0};
+    std::size_t _next{0};
+  };
+
+}  // namespace adv_sk::bench
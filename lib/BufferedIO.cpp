@@ -0,0 +1,158 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "BufferedIO.hpp"
+
+#include <cerrno>     // for errno, EINTR
+#include <cstddef>    // for ptrdiff_t
+#include <cstring>    // for memchr, memmove
+#include <stdexcept>  // for runtime_error
+
+#include <fcntl.h>     // for open, O_RDONLY
+#include <sys/mman.h>  // for mmap, munmap, madvise
+#include <sys/stat.h>  // for fstat, S_ISREG
+#include <unistd.h>    // for read, write, close
+
+namespace adv_sk {
+
+  LineReader::LineReader(const std::filesystem::path& path) {
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+      throw std::runtime_error("Cannot open input: " + path.string());
+    }
+    _owns_descriptor = true;
+    attach(descriptor);
+  }
+
+  LineReader::LineReader(int descriptor) {
+    attach(descriptor);
+  }
+
+  LineReader::~LineReader() {
+    if (_mapping != nullptr) {
+      munmap(_mapping, _mapping_length);
+    }
+    if (_owns_descriptor && _descriptor >= 0) {
+      close(_descriptor);
+    }
+  }
+
+  void LineReader::attach(int descriptor) {
+    _descriptor = descriptor;
+    struct stat status {};
+    if (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) &&
+        status.st_size > 0) {
+      const auto length = static_cast<std::size_t>(status.st_size);
+      void* address =
+          mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (address != MAP_FAILED) {
+        madvise(address, length, MADV_SEQUENTIAL);
+        _mapping = address;
+        _mapping_length = length;
+        _data = static_cast<const char*>(address);
+        _end = length;
+        _at_end = true;
+        return;
+      }
+    }
+    // Not a mappable file: read it block by block.
+    _buffer.resize(BLOCK_SIZE);
+    _data = _buffer.data();
+  }
+
+  std::optional<std::string_view> LineReader::next_line() {
+    for (;;) {
+      const auto* const begin = _data + _position;
+      const auto available = _end - _position;
+      if (const auto* const newline = static_cast<const char*>(
+              std::memchr(begin, '\n', available))) {
+        auto length = static_cast<std::size_t>(newline - begin);
+        _position += length + 1;
+        if (length > 0 && begin[length - 1] == '\r') {
+          --length;
+        }
+        return std::string_view(begin, length);
+      }
+      if (_at_end) {
+        if (available == 0) {
+          return std::nullopt;
+        }
+        _position = _end;
+        return std::string_view(begin, available);
+      }
+      refill();
+    }
+  }
+
+  void LineReader::refill() {
+    const auto tail = _end - _position;
+    if (tail > 0 && _position > 0) {
+      std::memmove(_buffer.data(), _buffer.data() + _position, tail);
+    }
+    _position = 0;
+    _end = tail;
+    if (_end == _buffer.size()) {
+      // A line longer than the buffer.
+      _buffer.resize(_buffer.size() * 2);
+    }
+    _data = _buffer.data();
+
+    for (;;) {
+      const auto count =
+          ::read(_descriptor, _buffer.data() + _end, _buffer.size() - _end);
+      if (count > 0) {
+        _end += static_cast<std::size_t>(count);
+        return;
+      }
+      if (count == 0) {
+        _at_end = true;
+        return;
+      }
+      if (errno != EINTR) {
+        throw std::runtime_error("Cannot read input");
+      }
+    }
+  }
+
+  BufferedWriter::BufferedWriter(int descriptor, std::size_t flush_size)
+      : _descriptor(descriptor), _flush_size(flush_size) {
+    _buffer.reserve(flush_size * 2);
+  }
+
+  BufferedWriter::~BufferedWriter() {
+    try {
+      flush();
+    } catch (const std::runtime_error&) {
+      // Nowhere left to report it.
+    }
+  }
+
+  void BufferedWriter::write(std::string_view text) {
+    _buffer.insert(_buffer.end(), text.begin(), text.end());
+    if (_buffer.size() >= _flush_size) {
+      flush();
+    }
+  }
+
+  void BufferedWriter::flush() {
+    std::size_t done = 0;
+    while (done < _buffer.size()) {
+      const auto count =
+          ::write(_descriptor, _buffer.data() + done, _buffer.size() - done);
+      if (count < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        _written += done;
+        _buffer.erase(_buffer.begin(),
+                      _buffer.begin() + static_cast<std::ptrdiff_t>(done));
+        throw std::runtime_error("Cannot write output");
+      }
+      done += static_cast<std::size_t>(count);
+    }
+    _written += done;
+    _buffer.clear();
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,109 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include <cstddef>      // for size_t
+#include <filesystem>   // for path
+#include <optional>     // for optional
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  /**
+   * @brief Splits a file or pipe into lines without copying them.
+   *
+   * A regular file is memory-mapped and every line is a view into the
+   * mapping. Anything else (pipes, terminals, sockets) is read in blocks of
+   * BLOCK_SIZE bytes into one buffer that only grows for a line longer than
+   * it. A returned line is valid until the next call to next_line(). Line
+   * ends are "\n" or "\r\n"; the last line needs no line end.
+   */
+  class LineReader {
+   public:
+    static constexpr std::size_t BLOCK_SIZE = std::size_t{1} << 20;
+
+    /// Opens `path`; throws std::runtime_error when it cannot be read.
+    explicit LineReader(const std::filesystem::path& path);
+
+    /// Reads from a descriptor the caller keeps open, such as stdin.
+    explicit LineReader(int descriptor);
+
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+    LineReader(LineReader&&) = delete;
+    LineReader& operator=(LineReader&&) = delete;
+    ~LineReader();
+
+    /// The next line, or nullopt at the end of the input.
+    std::optional<std::string_view> next_line();
+
+    /// Whether the input was mapped rather than read.
+    [[nodiscard]] bool mapped() const {
+      return _mapping != nullptr;
+    }
+
+   private:
+    void attach(int descriptor);
+
+    /// Moves the unread tail to the front and reads more after it.
+    void refill();
+
+    int _descriptor{-1};
+    bool _owns_descriptor{false};
+    void* _mapping{nullptr};
+    std::size_t _mapping_length{0};
+    std::vector<char> _buffer{};
+    const char* _data{nullptr};
+    std::size_t _position{0};
+    std::size_t _end{0};
+    bool _at_end{false};
+  };
+
+  /**
+   * @brief Collects output and writes it to a descriptor in large chunks.
+   *
+   * Nothing reaches the descriptor until FLUSH_SIZE bytes are waiting,
+   * flush() is called or the writer is destroyed. Throws
+   * std::runtime_error when a write fails.
+   */
+  class BufferedWriter {
+   public:
+    static constexpr std::size_t FLUSH_SIZE = std::size_t{1} << 16;
+
+    /// Writes to a descriptor the caller keeps open, such as stdout.
+    explicit BufferedWriter(int descriptor,
+                            std::size_t flush_size = FLUSH_SIZE);
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+    BufferedWriter(BufferedWriter&&) = delete;
+    BufferedWriter& operator=(BufferedWriter&&) = delete;
+    ~BufferedWriter();
+
+    void write(std::string_view text);
+
+    void put(char character) {
+      _buffer.push_back(character);
+      if (_buffer.size() >= _flush_size) {
+        flush();
+      }
+    }
+
+    void flush();
+
+    /// Bytes handed to the descriptor so far.
+    [[nodiscard]] std::size_t written() const {
+      return _written;
+    }
+
+   private:
+    int _descriptor;
+    std::size_t _flush_size;
+    std::vector<char> _buffer{};
+    std::size_t _written{0};
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,190 @@
+// LineReader and BufferedWriter unit tests
+
+#include "BufferedIO.hpp"
+
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <filesystem>   // for path, temp_directory_path, remove
+#include <fstream>      // for ofstream
+#include <optional>     // for optional
+#include <stdexcept>    // for runtime_error
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <thread>       // for thread
+#include <vector>       // for vector
+
+#include <unistd.h>  // for pipe, read, write, close
+
+namespace adv_sk::test {
+
+  namespace {
+    /// A file in the temp directory, removed when the test ends.
+    class TempFile {
+     public:
+      explicit TempFile(std::string_view text)
+          : _path(std::filesystem::temp_directory_path() /
+                  "adv_sk_buffered_io.test") {
+        std::ofstream(_path, std::ios::binary) << text;
+      }
+
+      TempFile(const TempFile&) = delete;
+      TempFile& operator=(const TempFile&) = delete;
+      TempFile(TempFile&&) = delete;
+      TempFile& operator=(TempFile&&) = delete;
+
+      ~TempFile() {
+        std::filesystem::remove(_path);
+      }
+
+      [[nodiscard]] const std::filesystem::path& path() const {
+        return _path;
+      }
+
+     private:
+      std::filesystem::path _path;
+    };
+
+    /// Both ends of a pipe, closed when the test ends.
+    class Pipe {
+     public:
+      Pipe() {
+        if (::pipe(_ends.data()) != 0) {
+          throw std::runtime_error("pipe failed");
+        }
+      }
+
+      Pipe(const Pipe&) = delete;
+      Pipe& operator=(const Pipe&) = delete;
+      Pipe(Pipe&&) = delete;
+      Pipe& operator=(Pipe&&) = delete;
+
+      ~Pipe() {
+        close_write();
+        close(_ends[0]);
+      }
+
+      [[nodiscard]] int read_end() const {
+        return _ends[0];
+      }
+
+      [[nodiscard]] int write_end() const {
+        return _ends[1];
+      }
+
+      void close_write() {
+        if (_ends[1] >= 0) {
+          close(_ends[1]);
+          _ends[1] = -1;
+        }
+      }
+
+      /// Everything left in the pipe; the write end must be closed.
+      std::string drain() const {
+        std::string text;
+        std::array<char, 4096> block{};
+        for (ssize_t count = 0;
+             (count = ::read(_ends[0], block.data(), block.size())) > 0;) {
+          text.append(block.data(), static_cast<std::size_t>(count));
+        }
+        return text;
+      }
+
+     private:
+      std::array<int, 2> _ends{-1, -1};
+    };
+
+    std::vector<std::string> all_lines(LineReader& reader) {
+      std::vector<std::string> lines;
+      while (const auto line = reader.next_line()) {
+        lines.emplace_back(line.value());
+      }
+      return lines;
+    }
+  }  // namespace
+
+  TEST(LineReader, mapsFilesAndSplitsLines) {
+    const TempFile file("move North\r\ninvestigate\n\ntake lamp");
+    LineReader reader(file.path());
+    EXPECT_TRUE(reader.mapped());
+    EXPECT_EQ(all_lines(reader),
+              (std::vector<std::string>{"move North", "investigate", "",
+                                        "take lamp"}));
+    EXPECT_FALSE(reader.next_line().has_value());
+  }
+
+  TEST(LineReader, emptyFileHasNoLines) {
+    const TempFile file("");
+    LineReader reader(file.path());
+    EXPECT_FALSE(reader.next_line().has_value());
+  }
+
+  TEST(LineReader, missingFileThrows) {
+    EXPECT_THROW(LineReader(std::filesystem::path("/nonexistent/input")),
+                 std::runtime_error);
+  }
+
+  TEST(LineReader, readsPipesAcrossBlockBoundaries) {
+    Pipe pipe;
+    // More than one block, with lines straddling every boundary.
+    const std::string line(1000, 'x');
+    const std::size_t count = (LineReader::BLOCK_SIZE / line.size()) * 3;
+    std::thread writer([&] {
+      std::string text;
+      for (std::size_t index = 0; index < count; ++index) {
+        text.append(line).push_back('\n');
+      }
+      for (std::size_t done = 0; done < text.size();) {
+        done += static_cast<std::size_t>(::write(
+            pipe.write_end(), text.data() + done, text.size() - done));
+      }
+      pipe.close_write();
+    });
+
+    LineReader reader(pipe.read_end());
+    EXPECT_FALSE(reader.mapped());
+    std::size_t lines = 0;
+    while (const auto next = reader.next_line()) {
+      ASSERT_EQ(next.value(), line);
+      ++lines;
+    }
+    writer.join();
+    EXPECT_EQ(lines, count);
+  }
+
+  TEST(LineReader, growsForLinesLongerThanABlock) {
+    const std::string line(LineReader::BLOCK_SIZE + 10, 'y');
+    Pipe pipe;
+    std::thread writer([&] {
+      const std::string text = line + "\nshort";
+      for (std::size_t done = 0; done < text.size();) {
+        done += static_cast<std::size_t>(::write(
+            pipe.write_end(), text.data() + done, text.size() - done));
+      }
+      pipe.close_write();
+    });
+
+    LineReader reader(pipe.read_end());
+    EXPECT_EQ(reader.next_line(), line);
+    EXPECT_EQ(reader.next_line(), "short");
+    EXPECT_FALSE(reader.next_line().has_value());
+    writer.join();
+  }
+
+  TEST(BufferedWriter, holdsOutputUntilTheThreshold) {
+    Pipe pipe;
+    {
+      BufferedWriter writer(pipe.write_end(), 8);
+      writer.write("abc");
+      writer.put('d');
+      EXPECT_EQ(writer.written(), 0);
+      writer.write("efgh");
+      EXPECT_EQ(writer.written(), 8);
+      writer.write("ij");
+    }
+    pipe.close_write();
+    EXPECT_EQ(pipe.drain(), "abcdefghij");
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,138 @@
+// CommandParser benchmarks
+
+#include "CommandParser.hpp"
+
+#include "Direction.hpp"          // for Direction
+#include "IInputHandler.hpp"      // for Action
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <stdexcept>  // for runtime_error
+#include <string>     // for string
+
+namespace adv_sk::bench {
+
+  namespace {
+    /// The comparison chain the console parser used before.
+    Action chained_action(const std::string& action) {
+      if (action == "quit") {
+        return Action::Quit;
+      }
+      if (action == "move") {
+        return Action::Move;
+      }
+      if (action == "use") {
+        return Action::UseItem;
+      }
+      if (action == "investigate") {
+        return Action::Investigate;
+      }
+      if (action == "take") {
+        return Action::TakeItem;
+      }
+      if (action == "travel") {
+        return Action::TravelTo;
+      }
+      return Action::Quit;
+    }
+
+    /// The comparison chain string_to_direction used before.
+    Direction chained_direction(const std::string& direction) {
+      if (direction == "North") {
+        return Direction::North;
+      }
+      if (direction == "South") {
+        return Direction::South;
+      }
+      if (direction == "East") {
+        return Direction::East;
+      }
+      if (direction == "West") {
+        return Direction::West;
+      }
+      throw std::runtime_error("Unknown direction");
+    }
+
+    const std::array<std::string, 6> ACTIONS{"quit", "move",   "use",
+                                             "investigate", "take", "travel"};
+    const std::array<std::string, 4> DIRECTIONS{"North", "South", "East",
+                                                "West"};
+
+    void BM_ActionChain(benchmark::State& state) {
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(chained_action(ACTIONS[index]));
+        index = (index + 1) % ACTIONS.size();
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ActionChain);
+
+    void BM_ParseAction(benchmark::State& state) {
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_action(ACTIONS[index]));
+        index = (index + 1) % ACTIONS.size();
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ParseAction);
+
+    void BM_DirectionChain(benchmark::State& state) {
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(chained_direction(DIRECTIONS[index]));
+        index = (index + 1) % DIRECTIONS.size();
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_DirectionChain);
+
+    void BM_ParseDirection(benchmark::State& state) {
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_direction(DIRECTIONS[index]));
+        index = (index + 1) % DIRECTIONS.size();
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ParseDirection);
+
+    /// Junk input: the chain throws, the parser returns nullopt.
+    void BM_DirectionChainInvalid(benchmark::State& state) {
+      const std::string input("Up");
+      for (auto _ : state) {
+        try {
+          benchmark::DoNotOptimize(chained_direction(input));
+        } catch (const std::runtime_error& error) {
+          benchmark::DoNotOptimize(error.what());
+        }
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_DirectionChainInvalid);
+
+    void BM_ParseDirectionInvalid(benchmark::State& state) {
+      const std::string input("Up");
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_direction(input));
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ParseDirectionInvalid);
+
+    void BM_ParseCommand(benchmark::State& state) {
+      const std::array<std::string, 4> lines{"go north", "take golden chalice",
+                                             "inv", "dance wildly"};
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_command(lines[index]));
+        index = (index + 1) % lines.size();
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ParseCommand);
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,65 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "CommandParser.hpp"
+
+namespace adv_sk {
+
+  namespace {
+    constexpr std::string_view WHITESPACE = " \t\r\n";
+
+    /// Splits off the first word; `rest` keeps what follows, trimmed.
+    std::string_view first_word(std::string_view text,
+                                 std::string_view& rest) {
+      const auto end = text.find_first_of(WHITESPACE);
+      if (end == std::string_view::npos) {
+        rest = {};
+        return text;
+      }
+      rest = trim(text.substr(end));
+      return text.substr(0, end);
+    }
+  }  // namespace
+
+  std::string_view trim(std::string_view text) {
+    const auto first = text.find_first_not_of(WHITESPACE);
+    if (first == std::string_view::npos) {
+      return {};
+    }
+    const auto last = text.find_last_not_of(WHITESPACE);
+    return text.substr(first, last - first + 1);
+  }
+
+  Command parse_command(std::string_view line) {
+    line = trim(line);
+    if (line.empty()) {
+      return Command{.error = CommandError::Empty};
+    }
+    std::string_view rest;
+    const auto word = first_word(line, rest);
+    const auto token = command_detail::lookup(word);
+    if (!token.has_value()) {
+      return Command{.error = CommandError::UnknownCommand};
+    }
+    if (token->is_direction) {
+      return Command{.action = Action::Move,
+                     .direction = static_cast<Direction>(token->value)};
+    }
+
+    Command command{.action = static_cast<Action>(token->value)};
+    if (command.action == Action::Move) {
+      if (!rest.empty()) {
+        std::string_view unused;
+        command.direction = parse_direction(first_word(rest, unused));
+        if (!command.direction.has_value()) {
+          command.error = CommandError::UnknownDirection;
+        }
+      }
+    } else {
+      command.argument = rest;
+    }
+    return command;
+  }
+
+}  // namespace adv_sk
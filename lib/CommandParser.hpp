@@ -0,0 +1,228 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"      // for Direction
+#include "IInputHandler.hpp"  // for Action
+
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint64_t
+#include <optional>     // for optional, nullopt
+#include <string_view>  // for string_view
+
+namespace adv_sk {
+
+  enum class CommandError : std::uint8_t {
+    None,
+    Empty,
+    UnknownCommand,
+    UnknownDirection,
+  };
+
+  /// One parsed command line; views the text it was parsed from.
+  struct Command {
+    Action action{Action::Quit};
+    /// Given for "go north" or "n"; a bare "move" leaves it to be asked.
+    std::optional<Direction> direction{};
+    /// Item or room name after the command word, trimmed.
+    std::string_view argument{};
+    CommandError error{CommandError::None};
+
+    [[nodiscard]] bool ok() const {
+      return error == CommandError::None;
+    }
+  };
+
+  namespace command_detail {
+    /// What a vocabulary word stands for.
+    struct Token {
+      bool is_direction;
+      std::uint8_t value;
+    };
+
+    struct Word {
+      std::string_view text;
+      Token token;
+    };
+
+    constexpr Token action(Action action) {
+      return Token{false, static_cast<std::uint8_t>(action)};
+    }
+
+    constexpr Token direction(Direction direction) {
+      return Token{true, static_cast<std::uint8_t>(direction)};
+    }
+
+    /// Every word in lower case; lookups ignore case.
+    inline constexpr std::array VOCABULARY{
+        Word{"move", action(Action::Move)},
+        Word{"go", action(Action::Move)},
+        Word{"walk", action(Action::Move)},
+        Word{"investigate", action(Action::Investigate)},
+        Word{"search", action(Action::Investigate)},
+        Word{"look", action(Action::Investigate)},
+        Word{"l", action(Action::Investigate)},
+        Word{"take", action(Action::TakeItem)},
+        Word{"get", action(Action::TakeItem)},
+        Word{"inventory", action(Action::DisplayInventory)},
+        Word{"inv", action(Action::DisplayInventory)},
+        Word{"i", action(Action::DisplayInventory)},
+        Word{"use", action(Action::UseItem)},
+        Word{"drop", action(Action::DropItem)},
+        Word{"travel", action(Action::TravelTo)},
+        Word{"goto", action(Action::TravelTo)},
+        Word{"quit", action(Action::Quit)},
+        Word{"exit", action(Action::Quit)},
+        Word{"q", action(Action::Quit)},
+        Word{"north", direction(Direction::North)},
+        Word{"n", direction(Direction::North)},
+        Word{"south", direction(Direction::South)},
+        Word{"s", direction(Direction::South)},
+        Word{"east", direction(Direction::East)},
+        Word{"e", direction(Direction::East)},
+        Word{"west", direction(Direction::West)},
+        Word{"w", direction(Direction::West)},
+    };
+
+    static_assert(
+        [] {
+          std::array<bool, static_cast<std::size_t>(Action::Quit) + 1>
+              actions{};
+          std::array<bool, DIRECTION_COUNT> directions{};
+          for (const auto& word : VOCABULARY) {
+            (word.token.is_direction ? directions[word.token.value]
+                                     : actions[word.token.value]) = true;
+          }
+          for (const auto covered : actions) {
+            if (!covered) {
+              return false;
+            }
+          }
+          for (const auto covered : directions) {
+            if (!covered) {
+              return false;
+            }
+          }
+          return true;
+        }(),
+        "VOCABULARY must name every Action and every Direction");
+
+    inline constexpr std::size_t TABLE_BITS = 7;
+    inline constexpr std::size_t TABLE_SIZE = std::size_t{1} << TABLE_BITS;
+    inline constexpr std::uint8_t NO_WORD = 0xFF;
+    inline constexpr std::size_t MAX_WORD_LENGTH = 16;
+
+    /// Up to MAX_WORD_LENGTH bytes, each with the 0x20 bit set. For the
+    /// letters the vocabulary is made of, that folds case and nothing else.
+    struct Packed {
+      std::uint64_t low;
+      std::uint64_t high;
+
+      constexpr bool operator==(const Packed& other) const = default;
+    };
+
+    constexpr Packed pack(std::string_view word) {
+      Packed packed{0, 0};
+      for (std::size_t index = 0; index < word.size(); ++index) {
+        const auto byte = static_cast<std::uint64_t>(
+            static_cast<unsigned char>(word[index]) | 0x20U);
+        (index < 8 ? packed.low : packed.high) |= byte << (8 * (index % 8));
+      }
+      return packed;
+    }
+
+    constexpr std::size_t slot_of(const Packed& word, std::uint64_t seed) {
+      const auto mixed = (word.low * 0x9E3779B97F4A7C15ULL) ^
+                         (word.high * 0xC2B2AE3D27D4EB4FULL) ^ seed;
+      return static_cast<std::size_t>((mixed * 0xFF51AFD7ED558CCDULL) >>
+                                      (64 - TABLE_BITS));
+    }
+
+    constexpr std::optional<std::array<std::uint8_t, TABLE_SIZE>> try_seed(
+        std::uint64_t seed) {
+      std::array<std::uint8_t, TABLE_SIZE> table{};
+      table.fill(NO_WORD);
+      for (std::size_t index = 0; index < VOCABULARY.size(); ++index) {
+        auto& slot = table[slot_of(pack(VOCABULARY[index].text), seed)];
+        if (slot != NO_WORD) {
+          return std::nullopt;
+        }
+        slot = static_cast<std::uint8_t>(index);
+      }
+      return table;
+    }
+
+    /// The first seed under which no two words share a slot.
+    constexpr std::uint64_t find_seed() {
+      for (std::uint64_t seed = 0;; ++seed) {
+        if (try_seed(seed).has_value()) {
+          return seed;
+        }
+      }
+    }
+
+    inline constexpr std::uint64_t SEED = find_seed();
+    inline constexpr auto TABLE = try_seed(SEED).value();
+
+    /// Each vocabulary word packed, so a lookup compares two integers.
+    inline constexpr auto PACKED = [] {
+      std::array<Packed, VOCABULARY.size()> packed{};
+      for (std::size_t index = 0; index < VOCABULARY.size(); ++index) {
+        packed[index] = pack(VOCABULARY[index].text);
+      }
+      return packed;
+    }();
+
+    constexpr std::optional<Token> lookup(std::string_view word) {
+      if (word.size() > MAX_WORD_LENGTH) {
+        return std::nullopt;
+      }
+      const auto packed = pack(word);
+      const auto index = TABLE[slot_of(packed, SEED)];
+      if (index == NO_WORD || PACKED[index] != packed ||
+          VOCABULARY[index].text.size() != word.size()) {
+        return std::nullopt;
+      }
+      return VOCABULARY[index].token;
+    }
+  }  // namespace command_detail
+
+  /**
+   * @brief A direction word or its first letter, in any case.
+   *
+   * One hash, one table probe and one comparison; never throws.
+   */
+  constexpr std::optional<Direction> parse_direction(std::string_view word) {
+    const auto token = command_detail::lookup(word);
+    if (!token.has_value() || !token->is_direction) {
+      return std::nullopt;
+    }
+    return static_cast<Direction>(token->value);
+  }
+
+  /// An action word or alias ("take", "get", "inv", "q"), in any case.
+  constexpr std::optional<Action> parse_action(std::string_view word) {
+    const auto token = command_detail::lookup(word);
+    if (!token.has_value() || token->is_direction) {
+      return std::nullopt;
+    }
+    return static_cast<Action>(token->value);
+  }
+
+  /// `text` without leading or trailing spaces, tabs or line breaks.
+  std::string_view trim(std::string_view text);
+
+  /**
+   * @brief Parses a command line such as "go north", "n", "take golden
+   * chalice" or "inv".
+   *
+   * A direction on its own means moving that way. Problems are reported in
+   * Command::error rather than thrown, so junk input costs no more than a
+   * valid command.
+   */
+  Command parse_command(std::string_view line);
+
+}  // namespace adv_sk
@@ -0,0 +1,82 @@
+// CommandParser unit tests
+
+#include "CommandParser.hpp"
+
+#include "Direction.hpp"      // for Direction
+#include "IInputHandler.hpp"  // for Action
+#include "gtest/gtest.h"      // for TEST, EXPECT_EQ
+
+#include <optional>  // for nullopt
+
+namespace adv_sk::test {
+
+  static_assert(parse_direction("North") == Direction::North);
+  static_assert(parse_action("inv") == Action::DisplayInventory);
+
+  TEST(CommandParser, parsesDirectionsInAnyCase) {
+    EXPECT_EQ(parse_direction("North"), Direction::North);
+    EXPECT_EQ(parse_direction("SOUTH"), Direction::South);
+    EXPECT_EQ(parse_direction("east"), Direction::East);
+    EXPECT_EQ(parse_direction("w"), Direction::West);
+    EXPECT_EQ(parse_direction("N"), Direction::North);
+  }
+
+  TEST(CommandParser, rejectsUnknownWords) {
+    EXPECT_EQ(parse_direction("Up"), std::nullopt);
+    EXPECT_EQ(parse_direction(""), std::nullopt);
+    EXPECT_EQ(parse_direction("northward"), std::nullopt);
+    EXPECT_EQ(parse_direction("take"), std::nullopt);
+    EXPECT_EQ(parse_action("north"), std::nullopt);
+    EXPECT_EQ(parse_action("dance"), std::nullopt);
+  }
+
+  TEST(CommandParser, parsesEveryActionAndAlias) {
+    EXPECT_EQ(parse_action("move"), Action::Move);
+    EXPECT_EQ(parse_action("go"), Action::Move);
+    EXPECT_EQ(parse_action("investigate"), Action::Investigate);
+    EXPECT_EQ(parse_action("look"), Action::Investigate);
+    EXPECT_EQ(parse_action("take"), Action::TakeItem);
+    EXPECT_EQ(parse_action("get"), Action::TakeItem);
+    EXPECT_EQ(parse_action("inventory"), Action::DisplayInventory);
+    EXPECT_EQ(parse_action("i"), Action::DisplayInventory);
+    EXPECT_EQ(parse_action("use"), Action::UseItem);
+    EXPECT_EQ(parse_action("drop"), Action::DropItem);
+    EXPECT_EQ(parse_action("travel"), Action::TravelTo);
+    EXPECT_EQ(parse_action("Quit"), Action::Quit);
+    EXPECT_EQ(parse_action("q"), Action::Quit);
+  }
+
+  TEST(CommandParser, bareDirectionMoves) {
+    const auto command = parse_command("  n ");
+    ASSERT_TRUE(command.ok());
+    EXPECT_EQ(command.action, Action::Move);
+    EXPECT_EQ(command.direction, Direction::North);
+  }
+
+  TEST(CommandParser, moveTakesDirectionWord) {
+    const auto command = parse_command("go West");
+    ASSERT_TRUE(command.ok());
+    EXPECT_EQ(command.action, Action::Move);
+    EXPECT_EQ(command.direction, Direction::West);
+
+    const auto bare = parse_command("move");
+    ASSERT_TRUE(bare.ok());
+    EXPECT_EQ(bare.direction, std::nullopt);
+  }
+
+  TEST(CommandParser, argumentKeepsCaseAndSpaces) {
+    const auto command = parse_command("take  Golden Chalice \r");
+    ASSERT_TRUE(command.ok());
+    EXPECT_EQ(command.action, Action::TakeItem);
+    EXPECT_EQ(command.argument, "Golden Chalice");
+  }
+
+  TEST(CommandParser, reportsErrorsWithoutThrowing) {
+    EXPECT_EQ(parse_command("").error, CommandError::Empty);
+    EXPECT_EQ(parse_command(" \t").error, CommandError::Empty);
+    EXPECT_EQ(parse_command("dance wildly").error,
+              CommandError::UnknownCommand);
+    EXPECT_EQ(parse_command("go up").error, CommandError::UnknownDirection);
+  }
+
+}  // namespace adv_sk::test
@@ -4,59 +4,64 @@
 
 #include "ConsoleInputHandler.h"
 
-#include "Direction.hpp"  // for direction_to_string, string_to_...
+#include "CommandParser.hpp"  // for parse_command, parse_direction, trim
+#include "Direction.hpp"      // for direction_to_string
 
 #include <iostream>
-#include <vector>  // for vector
+#include <optional>  // for optional, nullopt
+#include <utility>   // for exchange
 
 namespace adv_sk {
 
-  namespace {
-    Action string_to_action(const std::string& action) {
-      if (action == "quit") {
-        return Action::Quit;
-      }
-      if (action == "move") {
-        return Action::Move;
-      }
-      if (action == "use") {
-        return Action::UseItem;
-      }
-      if (action == "investigate") {
-        return Action::Investigate;
-      }
-      if (action == "take") {
-        return Action::TakeItem;
-      }
-
-      return Action::Quit;
-    }
-  }  // namespace
-
   Action ConsoleInputHandler::get_action() {
-    std::string action;
+    std::string line;
     std::cout << "Enter action (quit to exit): ";
-    std::getline(std::cin, action);
-    return string_to_action(action);
+    std::getline(std::cin, line);
+    const auto command = parse_command(line);
+    if (!command.ok()) {
+      return Action::Quit;
+    }
+    // "go north" or "take lamp" answers the follow-up question up front.
+    _pending_direction = command.direction;
+    _pending_argument = std::string(command.argument);
+    return command.action;
   }
-  void ConsoleInputHandler::provide_directions(
-      const std::vector<Direction>& directions) {
+  void ConsoleInputHandler::provide_directions(DirectionSet directions) {
     std::cout << "Available directions:\n";
-    for (const auto& direction : directions) {
+    for (const auto direction : directions) {
       std::cout << "- " << direction_to_string(direction) << '\n';
     }
   }
-  Direction ConsoleInputHandler::get_direction() {
+  std::optional<Direction> ConsoleInputHandler::get_direction() {
+    if (const auto pending = std::exchange(_pending_direction, std::nullopt)) {
+      return pending.value();
+    }
     std::string input;
     std::cout << "Choose direction: ";
-    std::getline(std::cin, input);
-    return string_to_direction(input);
+    while (std::getline(std::cin, input)) {
+      if (const auto direction = parse_direction(trim(input))) {
+        return direction.value();
+      }
+      std::cout << "Wrong direction!\nChoose direction: ";
+    }
+    return std::nullopt;
   }
 
-  void ConsoleInputHandler::provide_message(const std::string& message) {
+  void ConsoleInputHandler::provide_message(std::string_view message) {
     std::cout << message << "\n";
   }
   std::string ConsoleInputHandler::get_item_name() {
+    if (!_pending_argument.empty()) {
+      return std::exchange(_pending_argument, {});
+    }
+    std::string input;
+    std::getline(std::cin, input);
+    return input;
+  }
+  std::string ConsoleInputHandler::get_room_name() {
+    if (!_pending_argument.empty()) {
+      return std::exchange(_pending_argument, {});
+    }
     std::string input;
     std::getline(std::cin, input);
     return input;
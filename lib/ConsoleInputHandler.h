@@ -6,17 +6,25 @@
 
 #include "IInputHandler.hpp"  // for IInputHandler, Action
 
-#include <string>  // for string
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
 
 namespace adv_sk {
 
   class ConsoleInputHandler : public IInputHandler {
    public:
     Action get_action() override;
-    void provide_directions(const std::vector<Direction>& directions) override;
-    Direction get_direction() override;
-    void provide_message(const std::string& message) override;
+    void provide_directions(DirectionSet directions) override;
+    std::optional<Direction> get_direction() override;
+    void provide_message(std::string_view message) override;
     std::string get_item_name() override;
+    std::string get_room_name() override;
+
+   private:
+    /// Parts of the last command line that answer the next question.
+    std::optional<Direction> _pending_direction{};
+    std::string _pending_argument{};
   };
 
 }  // namespace adv_sk
@@ -2,14 +2,14 @@
 
 #include "ConsoleInputHandler.h"
 
-#include "Direction.hpp"      // for Direction
+#include "Direction.hpp"      // for Direction, DirectionSet
 #include "IInputHandler.hpp"  // for Action
 #include "gtest/gtest.h"      // for TEST, EXPECT_EQ
 
 #include <iostream>  // for cin, cout
+#include <optional>  // for nullopt
 #include <sstream>   // for istringstream, ostringstream
 #include <string>    // for string
-#include <vector>    // for vector
 
 namespace adv_sk::test {
 
@@ -80,13 +80,30 @@ namespace adv_sk::test {
     EXPECT_EQ(handler.get_action(), Action::Quit);
   }
 
-  TEST(ConsoleInputHandler, provideDirections) {
+  TEST(ConsoleInputHandler, getActionWithDirectionSkipsDirectionPrompt) {
+    const StreamRedirector redirect("go north\n");
+    ConsoleInputHandler handler;
+    EXPECT_EQ(handler.get_action(), Action::Move);
+    EXPECT_EQ(handler.get_direction(), Direction::North);
+    EXPECT_EQ(redirect.output().find("Choose direction"), std::string::npos);
+  }
+
+  TEST(ConsoleInputHandler, getActionWithItemSkipsItemPrompt) {
+    const StreamRedirector redirect("get golden chalice\nrusty sword\n");
+    ConsoleInputHandler handler;
+    EXPECT_EQ(handler.get_action(), Action::TakeItem);
+    EXPECT_EQ(handler.get_item_name(), "golden chalice");
+    EXPECT_EQ(handler.get_item_name(), "rusty sword");
+  }
+
+  TEST(ConsoleInputHandler, provideDirectionSet) {
     const StreamRedirector redirect("");
     ConsoleInputHandler handler;
-    handler.provide_directions({Direction::North, Direction::South});
-    const std::string result = redirect.output();
-    EXPECT_TRUE(result.find("North") != std::string::npos);
-    EXPECT_TRUE(result.find("South") != std::string::npos);
+    DirectionSet directions;
+    directions.insert(Direction::West);
+    directions.insert(Direction::North);
+    handler.provide_directions(directions);
+    EXPECT_EQ(redirect.output(), "Available directions:\n- North\n- West\n");
   }
 
   TEST(ConsoleInputHandler, getDirection) {
@@ -95,6 +112,21 @@ namespace adv_sk::test {
     EXPECT_EQ(handler.get_direction(), Direction::North);
   }
 
+  TEST(ConsoleInputHandler, getDirectionAsksAgainAfterAWrongOne) {
+    const StreamRedirector redirect("sideways\nEast\n");
+    ConsoleInputHandler handler;
+    EXPECT_EQ(handler.get_direction(), Direction::East);
+    EXPECT_EQ(redirect.output(),
+              "Choose direction: Wrong direction!\nChoose direction: ");
+  }
+
+  TEST(ConsoleInputHandler, getDirectionIsEmptyAtTheEndOfInput) {
+    const StreamRedirector redirect(" west\nsideways\n");
+    ConsoleInputHandler handler;
+    EXPECT_EQ(handler.get_direction(), Direction::West);
+    EXPECT_EQ(handler.get_direction(), std::nullopt);
+  }
+
   TEST(ConsoleInputHandler, provideMessage) {
     const StreamRedirector redirect("");
     ConsoleInputHandler handler;
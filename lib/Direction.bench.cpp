@@ -0,0 +1,41 @@
+// Direction parsing benchmarks
+
+#include "Direction.hpp"
+
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <stdexcept>  // for runtime_error
+#include <string>     // for string
+
+namespace adv_sk::bench {
+
+  namespace {
+    void BM_StringToDirection(benchmark::State& state) {
+      const std::array<std::string, 4> inputs{"North", "South", "East",
+                                              "West"};
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(string_to_direction(inputs[index]));
+        index = (index + 1) % inputs.size();
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_StringToDirection);
+
+    void BM_StringToDirectionInvalid(benchmark::State& state) {
+      const std::string input("Up");
+      for (auto _ : state) {
+        try {
+          benchmark::DoNotOptimize(string_to_direction(input));
+        } catch (const std::runtime_error& error) {
+          benchmark::DoNotOptimize(error.what());
+        }
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_StringToDirectionInvalid);
+  }  // namespace
+
+}  // namespace adv_sk::bench
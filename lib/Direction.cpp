@@ -1,5 +1,7 @@
 #include "Direction.hpp"
 
+#include "CommandParser.hpp"  // for parse_direction
+
 #include <stdexcept>
 
 namespace adv_sk {
@@ -28,18 +30,9 @@ namespace adv_sk {
         return "West";
     }
   }
-  Direction string_to_direction(const std::string& direction) {
-    if (direction == "North") {
-      return Direction::North;
-    }
-    if (direction == "South") {
-      return Direction::South;
-    }
-    if (direction == "East") {
-      return Direction::East;
-    }
-    if (direction == "West") {
-      return Direction::West;
+  Direction string_to_direction(std::string_view direction) {
+    if (const auto parsed = parse_direction(direction)) {
+      return parsed.value();
     }
     throw std::runtime_error("Unknown direction");
   }
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <array>
-#include <cstdint>  // for uint8_t
+#include <bit>          // for countr_zero, popcount
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <cstdint>      // for uint8_t, uint16_t
+#include <iterator>     // for forward_iterator_tag
 #include <string>
+#include <string_view>  // for string_view
+#include <type_traits>  // for conditional_t
 
 namespace adv_sk {
 
@@ -16,10 +21,116 @@ namespace adv_sk {
   inline constexpr std::array<Direction, 4> ALL_DIRECTIONS{
       Direction::North, Direction::South, Direction::East, Direction::West};
 
+  inline constexpr std::size_t DIRECTION_COUNT = ALL_DIRECTIONS.size();
+
+  /// Bit set with one bit per Direction, wide enough for every direction.
+  using DirectionMask = std::conditional_t<DIRECTION_COUNT <= 8, std::uint8_t,
+                                           std::uint16_t>;
+
+  constexpr std::size_t direction_index(Direction direction) {
+    return static_cast<std::size_t>(direction);
+  }
+
+  constexpr DirectionMask direction_bit(Direction direction) {
+    return static_cast<DirectionMask>(1U << direction_index(direction));
+  }
+
+  static_assert(
+      [] {
+        for (std::size_t index = 0; index < DIRECTION_COUNT; ++index) {
+          if (direction_index(ALL_DIRECTIONS[index]) != index) {
+            return false;
+          }
+        }
+        return true;
+      }(),
+      "ALL_DIRECTIONS must list every Direction in declaration order");
+
+  /**
+   * @brief Set of directions stored as a DirectionMask.
+   *
+   * Iteration visits the directions in ALL_DIRECTIONS order by scanning the
+   * set bits, so listing a room's exits needs no allocation.
+   */
+  class DirectionSet {
+   public:
+    class iterator {
+     public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = Direction;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = Direction;
+
+      constexpr iterator() = default;
+      constexpr explicit iterator(DirectionMask remaining)
+          : _remaining(remaining) {
+      }
+
+      constexpr Direction operator*() const {
+        return static_cast<Direction>(std::countr_zero(_remaining));
+      }
+
+      constexpr iterator& operator++() {
+        _remaining = static_cast<DirectionMask>(_remaining & (_remaining - 1));
+        return *this;
+      }
+
+      constexpr iterator operator++(int) {
+        auto previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      constexpr bool operator==(const iterator& other) const = default;
+
+     private:
+      DirectionMask _remaining{};
+    };
+
+    constexpr DirectionSet() = default;
+    constexpr explicit DirectionSet(DirectionMask mask) : _mask(mask) {
+    }
+
+    constexpr void insert(Direction direction) {
+      _mask = static_cast<DirectionMask>(_mask | direction_bit(direction));
+    }
+
+    [[nodiscard]] constexpr bool contains(Direction direction) const {
+      return (_mask & direction_bit(direction)) != 0;
+    }
+
+    [[nodiscard]] constexpr bool empty() const {
+      return _mask == 0;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const {
+      return static_cast<std::size_t>(std::popcount(_mask));
+    }
+
+    [[nodiscard]] constexpr DirectionMask mask() const {
+      return _mask;
+    }
+
+    [[nodiscard]] constexpr iterator begin() const {
+      return iterator{_mask};
+    }
+
+    [[nodiscard]] constexpr iterator end() const {
+      return iterator{};
+    }
+
+    constexpr bool operator==(const DirectionSet& other) const = default;
+
+   private:
+    DirectionMask _mask{};
+  };
+
   Direction opposite_direction(Direction direction);
 
   std::string direction_to_string(Direction direction);
 
-  Direction string_to_direction(const std::string& direction);
+  /// Like parse_direction(), but throws std::runtime_error when unknown.
+  Direction string_to_direction(std::string_view direction);
 
 }  // namespace adv_sk
@@ -6,6 +6,7 @@
 
 #include <stdexcept>
 #include <string>  // for basic_string
+#include <vector>  // for vector
 
 namespace adv_sk::test {
 
@@ -43,6 +44,32 @@ namespace adv_sk::test {
     EXPECT_EQ(direction_to_string(Direction::West), "West");
   }
 
+  // DirectionSet tests
+  TEST(DirectionSet, emptyByDefault) {
+    const DirectionSet directions;
+    EXPECT_TRUE(directions.empty());
+    EXPECT_EQ(directions.size(), 0);
+    EXPECT_EQ(directions.begin(), directions.end());
+  }
+
+  TEST(DirectionSet, iteratesInDirectionOrder) {
+    DirectionSet directions;
+    directions.insert(Direction::West);
+    directions.insert(Direction::North);
+    directions.insert(Direction::East);
+    const std::vector<Direction> listed(directions.begin(), directions.end());
+    EXPECT_EQ(listed, (std::vector<Direction>{Direction::North, Direction::East,
+                                              Direction::West}));
+    EXPECT_EQ(directions.size(), 3);
+    EXPECT_FALSE(directions.contains(Direction::South));
+  }
+
+  TEST(DirectionSet, constructsFromMask) {
+    const DirectionSet directions(direction_bit(Direction::South));
+    EXPECT_TRUE(directions.contains(Direction::South));
+    EXPECT_EQ(directions.mask(), direction_bit(Direction::South));
+  }
+
   // string_to_direction tests
   TEST(Direction, stringToNorth) {
     EXPECT_EQ(string_to_direction("North"), Direction::North);
@@ -60,6 +87,11 @@ namespace adv_sk::test {
     EXPECT_EQ(string_to_direction("West"), Direction::West);
   }
 
+  TEST(Direction, stringToDirectionAcceptsAbbreviations) {
+    EXPECT_EQ(string_to_direction("n"), Direction::North);
+    EXPECT_EQ(string_to_direction("WEST"), Direction::West);
+  }
+
   TEST(Direction, stringToDirectionInvalidThrows) {
     EXPECT_THROW(string_to_direction("Invalid"), std::runtime_error);
   }
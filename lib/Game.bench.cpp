@@ -0,0 +1,133 @@
+// Game benchmarks
+
+#include "Game.hpp"
+
+#include "ActionJournal.hpp"      // for ActionJournal
+#include "BenchmarkSupport.hpp"   // for make_corridor_map, ScriptedInputHandler
+#include "Direction.hpp"          // for Direction
+#include "IInputHandler.hpp"      // for IInputHandler, Action
+#include "Map.hpp"                // for Map
+#include "Player.hpp"             // for Player
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr, make_unique
+#include <string>   // for string, to_string
+#include <utility>  // for move
+#include <vector>   // for vector
+
+namespace adv_sk::bench {
+
+  namespace {
+    /// Game over a corridor world whose messages are kept, not printed.
+    Game make_headless_game(const benchmark::State& state) {
+      return Game{make_corridor_map(static_cast<std::size_t>(state.range(0)),
+                                    static_cast<std::size_t>(state.range(1))),
+                  std::make_unique<Player>(),
+                  std::unique_ptr<IInputHandler>{}};
+    }
+
+    void BM_GameMove(benchmark::State& state) {
+      auto game = make_headless_game(state);
+      for (auto _ : state) {
+        game.move(Direction::North);
+        game.move(Direction::South);
+      }
+      state.SetItemsProcessed(state.iterations() * 2);
+    }
+    BENCHMARK(BM_GameMove)->Apply(world_and_inventory_sizes);
+
+    void BM_GameInvestigate(benchmark::State& state) {
+      auto game = make_headless_game(state);
+      for (auto _ : state) {
+        game.investigate();
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_GameInvestigate)->Apply(world_and_inventory_sizes);
+
+    void BM_GameTakeDropItem(benchmark::State& state) {
+      auto game = make_headless_game(state);
+      game.investigate();
+      // The last item is the worst case for the lookup; dropping it puts it
+      // back at the end of the room inventory.
+      const auto item_name = "item" + std::to_string(state.range(1) - 1);
+      for (auto _ : state) {
+        game.take_item(item_name);
+        game.drop_item(item_name);
+      }
+      state.SetItemsProcessed(state.iterations() * 2);
+    }
+    BENCHMARK(BM_GameTakeDropItem)->Apply(world_and_inventory_sizes);
+
+    /// One round of every cheap action, replayed forever.
+    std::vector<ScriptedInputHandler::Step> action_round() {
+      return {
+          {.action = Action::Move, .direction = Direction::North},
+          {.action = Action::Investigate},
+          {.action = Action::TakeItem, .item_name = "item0"},
+          {.action = Action::DisplayInventory},
+          {.action = Action::DropItem, .item_name = "item0"},
+          {.action = Action::Move, .direction = Direction::South},
+      };
+    }
+
+    template <typename GameT>
+    void run_user_actions(benchmark::State& state, GameT& game) {
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(game.handle_user_action());
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_GameHandleUserAction(benchmark::State& state) {
+      std::unique_ptr<IInputHandler> input =
+          std::make_unique<ScriptedInputHandler>(action_round());
+      Game game{make_corridor_map(static_cast<std::size_t>(state.range(0)),
+                                  static_cast<std::size_t>(state.range(1))),
+                std::make_unique<Player>(), std::move(input)};
+      run_user_actions(state, game);
+    }
+    BENCHMARK(BM_GameHandleUserAction)->Apply(world_and_inventory_sizes);
+
+    /// The same actions with every call bound at compile time.
+    void BM_StaticGameHandleUserAction(benchmark::State& state) {
+      BasicGame<Map, Player, ScriptedInputHandler> game{
+          make_corridor_map(static_cast<std::size_t>(state.range(0)),
+                            static_cast<std::size_t>(state.range(1))),
+          std::make_unique<Player>(),
+          std::make_unique<ScriptedInputHandler>(action_round())};
+      run_user_actions(state, game);
+    }
+    BENCHMARK(BM_StaticGameHandleUserAction)
+        ->Apply(world_and_inventory_sizes);
+
+    /// The same again with every action journaled, to show what that costs.
+    void BM_StaticGameJournaled(benchmark::State& state) {
+      BasicGame<Map, Player, ScriptedInputHandler> game{
+          make_corridor_map(static_cast<std::size_t>(state.range(0)),
+                            static_cast<std::size_t>(state.range(1))),
+          std::make_unique<Player>(),
+          std::make_unique<ScriptedInputHandler>(action_round())};
+      ActionJournal journal;
+      game.set_journal(&journal);
+      run_user_actions(state, game);
+    }
+    BENCHMARK(BM_StaticGameJournaled)->Apply(world_and_inventory_sizes);
+
+    /// Journaled to a file, whose writes happen off the action's thread.
+    void BM_StaticGameJournaledToFile(benchmark::State& state) {
+      BasicGame<Map, Player, ScriptedInputHandler> game{
+          make_corridor_map(static_cast<std::size_t>(state.range(0)),
+                            static_cast<std::size_t>(state.range(1))),
+          std::make_unique<Player>(),
+          std::make_unique<ScriptedInputHandler>(action_round())};
+      auto journal = ActionJournal::create("/dev/null");
+      game.set_journal(&journal);
+      run_user_actions(state, game);
+    }
+    BENCHMARK(BM_StaticGameJournaledToFile)
+        ->Apply(world_and_inventory_sizes);
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -4,35 +4,107 @@
 
 #pragma once
 
-#include "Direction.hpp"      // for Direction
-#include "IInputHandler.hpp"  // for IInputHandler, Action
-#include "IMap.hpp"           // for IMap
-#include "IPlayer.hpp"        // for IPlayer
-#include "Types.hpp"          // for RoomName
+#include "ActionJournal.hpp"       // for ActionJournal
+#include "Direction.hpp"           // for Direction, DirectionSet
+#include "IAsyncInputHandler.hpp"  // for IAsyncInputHandler
+#include "IInputHandler.hpp"       // for IInputHandler, Action
+#include "IMap.hpp"                // for IMap
+#include "IPlayer.hpp"             // for IPlayer
+#include "Inventory.hpp"           // for Inventory, InventoryItem
+#include "MessageBuffer.hpp"       // for MessageBuffer
+#include "Router.hpp"              // for Router, find_route
+#include "Task.hpp"                // for Task
+#include "Types.hpp"               // for RoomName
 
-#include <memory>   // for unique_ptr
-#include <string>   // for string
-#include <utility>  // for move
-#include <vector>   // for vector
+#include <memory>       // for unique_ptr, shared_ptr
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
 
 namespace adv_sk {
 
-  class Game {
+  namespace game_detail {
+    inline constexpr std::string_view TAKE_PROMPT = "What do you want to take?";
+    inline constexpr std::string_view USE_PROMPT = "What do you want to use?";
+    inline constexpr std::string_view DROP_PROMPT = "What do you want to drop?";
+    inline constexpr std::string_view TRAVEL_PROMPT =
+        "Where do you want to go?";
+    inline constexpr std::string_view UNKNOWN_COMMAND =
+        "Command not recognized.";
+
+    /// What the player is asked for the action's name; empty if it has none.
+    constexpr std::string_view prompt_for(Action action) {
+      switch (action) {
+        case Action::TakeItem:
+          return TAKE_PROMPT;
+        case Action::UseItem:
+          return USE_PROMPT;
+        case Action::DropItem:
+          return DROP_PROMPT;
+        case Action::TravelTo:
+          return TRAVEL_PROMPT;
+        default:
+          return {};
+      }
+    }
+  }  // namespace game_detail
+
+  /**
+   * @brief The game rules over a map, a player and an input handler.
+   *
+   * Each is reached through its own template parameter, so a game over
+   * concrete final classes such as Map, Player and HeadlessInputHandler
+   * makes no virtual calls and the compiler can inline the whole action.
+   * Game is the instantiation over the interfaces, for mocks and for
+   * choosing the parts at run time. Async input always goes through
+   * IAsyncInputHandler; it waits on the player anyway.
+   */
+  template <typename MapT, typename PlayerT, typename InputT>
+  class BasicGame {
    public:
-    Game() = default;
-    explicit Game(std::unique_ptr<IMap> map, std::unique_ptr<IPlayer> player,
-                  std::unique_ptr<IInputHandler> input)
+    /// Used for the reply buffer; see SessionArena.
+    using allocator_type = MessageBuffer::allocator_type;
+
+    BasicGame() = default;
+    explicit BasicGame(std::unique_ptr<MapT> map,
+                       std::unique_ptr<PlayerT> player,
+                       std::unique_ptr<InputT> input,
+                       allocator_type allocator = {})
         : _map(std::move(map)),
           _player(std::move(player)),
-          _input_handler(std::move(input)) {
-      _player->change_room("GrandHall");
-      update_message(_map->get_welcome_message(_player->get_current_room()));
+          _input_handler(std::move(input)),
+          _message(MessageBuffer::DEFAULT_CAPACITY, allocator) {
+      enter_starting_room();
+    }
+
+    /// A game driven by run() instead of start().
+    explicit BasicGame(std::unique_ptr<MapT> map,
+                       std::unique_ptr<PlayerT> player,
+                       std::unique_ptr<IAsyncInputHandler> input,
+                       allocator_type allocator = {})
+        : _map(std::move(map)),
+          _player(std::move(player)),
+          _async_input(std::move(input)),
+          _message(MessageBuffer::DEFAULT_CAPACITY, allocator) {
+      enter_starting_room();
     }
 
     [[nodiscard]] bool handle_user_action();
 
     void start();
 
+    /// handle_user_action() for the async input; suspends while it waits.
+    Task<bool> handle_async_action();
+
+    /**
+     * @brief Async game loop, finishing at Action::Quit.
+     *
+     * The returned task is lazy: resume() it once, and the input handler
+     * resumes it whenever the player's next command arrives.
+     */
+    Task<> run();
+
     void move(Direction direction);
 
     void investigate();
@@ -45,24 +117,367 @@ namespace adv_sk {
 
     void drop_item(const std::string& item_name);
 
-    [[nodiscard]] std::vector<Direction> get_available_directions() const;
+    /**
+     * @brief Walks a shortest route to `destination` as a single move.
+     *
+     * The rooms passed on the way are named in one line before the
+     * destination's welcome message. Uses the router when one is set and
+     * a breadth-first search through the map otherwise.
+     */
+    void travel_to(const RoomName& destination);
+
+    /// Shared, read-only routes over the same world as the map.
+    void set_router(std::shared_ptr<const Router> router) {
+      _router = std::move(router);
+    }
+
+    /**
+     * @brief Records every action handled from now on into `journal`.
+     *
+     * Each action is recorded with its argument before it is carried out.
+     * The journal is not owned and must outlive the game; nullptr stops
+     * recording.
+     */
+    void set_journal(ActionJournal* journal) {
+      _journal = journal;
+    }
+
+    [[nodiscard]] DirectionSet get_available_directions() const;
 
+    /// The last reply, whether or not an input handler was given it.
     [[nodiscard]] std::string get_current_message() const {
-      return _current_message;
+      return std::string(_message.view());
     }
 
     [[nodiscard]] RoomName get_current_location() const {
-      return _player->get_current_room();
+      return RoomName(_map->get_room_name(_player->get_current_room()));
     }
 
    private:
-    void update_message(const std::string& message);
+    void enter_starting_room();
+
+    /// Starts a reply in the session's buffer.
+    MessageBuffer& render() {
+      return _message.clear();
+    }
+
+    /**
+     * @brief Records and carries out an action whose argument was read.
+     *
+     * Action::Move uses `direction`, the item and travel actions `name`.
+     * Returns false at Action::Quit.
+     */
+    bool perform(Action action, Direction direction = {},
+                 const std::string& name = {});
+
+    /// Hands text to whichever input handler the game has.
+    void provide(std::string_view text);
+
+    /// Hands the rendered reply to the input handler as a view.
+    void send_message() {
+      provide(_message.view());
+    }
 
-    std::unique_ptr<IMap> _map{nullptr};
-    std::unique_ptr<IPlayer> _player{nullptr};
-    std::unique_ptr<IInputHandler> _input_handler{nullptr};
+    /// Sends text that is already complete, such as a welcome message.
+    void update_message(std::string_view message);
 
-    std::string _current_message{};
+    /// Adds the action to the journal, if there is one.
+    template <typename... Argument>
+    void record(Action action, const Argument&... argument) {
+      if (_journal != nullptr) {
+        _journal->record(action, argument...);
+      }
+    }
+
+    std::unique_ptr<MapT> _map{nullptr};
+    std::unique_ptr<PlayerT> _player{nullptr};
+    std::unique_ptr<InputT> _input_handler{nullptr};
+    std::unique_ptr<IAsyncInputHandler> _async_input{nullptr};
+    std::shared_ptr<const Router> _router{nullptr};
+    ActionJournal* _journal{nullptr};
+
+    /// Reused for every reply, so steady-state play does not allocate.
+    MessageBuffer _message{};
   };
 
+  /// Every call goes through the interfaces; what the tests mock.
+  using Game = BasicGame<IMap, IPlayer, IInputHandler>;
+
+  extern template class BasicGame<IMap, IPlayer, IInputHandler>;
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::enter_starting_room() {
+    _player->change_room(_map->find_room("GrandHall").value());
+    update_message(_map->get_welcome_message(_player->get_current_room()));
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  bool BasicGame<MapT, PlayerT, InputT>::handle_user_action() {
+    const auto action = _input_handler->get_action();
+    if (action == Action::Move) {
+      _input_handler->provide_directions(get_available_directions());
+      const auto direction = _input_handler->get_direction();
+      if (!direction) {
+        return perform(Action::Quit);
+      }
+      return perform(action, direction.value());
+    }
+    const auto prompt = game_detail::prompt_for(action);
+    if (prompt.empty()) {
+      return perform(action);
+    }
+    _input_handler->provide_prompt(prompt);
+    const auto name = action == Action::TravelTo
+                          ? _input_handler->get_room_name()
+                          : _input_handler->get_item_name();
+    return perform(action, Direction{}, name);
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::start() {
+    if (!_input_handler) {
+      return;
+    }
+    while (handle_user_action()) {
+      // Game loop continues until Action::Quit
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  Task<bool> BasicGame<MapT, PlayerT, InputT>::handle_async_action() {
+    // Awaits stay out of conditions: GCC 12 miscompiles a co_await there.
+    const auto action = co_await _async_input->get_action();
+    if (action == Action::Move) {
+      _async_input->provide_directions(get_available_directions());
+      const auto direction = co_await _async_input->get_direction();
+      if (!direction) {
+        co_return perform(Action::Quit);
+      }
+      co_return perform(action, direction.value());
+    }
+    const auto prompt = game_detail::prompt_for(action);
+    if (prompt.empty()) {
+      co_return perform(action);
+    }
+    _async_input->provide_prompt(prompt);
+    std::string name;
+    if (action == Action::TravelTo) {
+      name = co_await _async_input->get_room_name();
+    } else {
+      name = co_await _async_input->get_item_name();
+    }
+    co_return perform(action, Direction{}, name);
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  Task<> BasicGame<MapT, PlayerT, InputT>::run() {
+    if (!_async_input) {
+      co_return;
+    }
+    for (bool running = true; running;) {
+      // Suspended between commands until the input handler resumes us
+      running = co_await handle_async_action();
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::move(Direction direction) {
+    if (const auto next_room =
+            _map->next_room(_player->get_current_room(), direction);
+        next_room.has_value()) {
+      _player->change_room(next_room.value());
+      update_message(_map->get_welcome_message(_player->get_current_room()));
+    } else {
+      update_message("Wrong direction!\n");
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::investigate() {
+    auto& message = render().append("You search the room. You found");
+    if (_map->reveal_items(_player->get_current_room(),
+                           [&message](const InventoryItem& item) {
+                             message.append(" a ").append(item.name());
+                           }) != 0) {
+      message.append("!\n");
+      send_message();
+    } else {
+      update_message("You search the room. Nothing found!\n");
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::take_item(
+      const std::string& item_name) {
+    if (const auto item =
+            _map->take_visible_item(_player->get_current_room(), item_name)) {
+      render().format("You take the {}\n", item_name);
+      send_message();
+      _player->add_to_inventory(item.value());
+    } else {
+      render().format("You can't take the {}\n", item_name);
+      send_message();
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::display_player_inventory() {
+    auto& message = render().append("Your inventory contains:");
+    for (const auto& item : _player->get_inventory()) {
+      message.append(" ").append(item.name());
+    }
+    message.append(".\n");
+    send_message();
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::use_item(
+      const std::string& item_name) {
+    auto& inventory = _player->get_mutable_inventory();
+    if (const auto item = inventory.find(item_name)) {
+      update_message(inventory.remove(item.value()).use_message());
+    } else {
+      render().format("You can't use the {}!\n", item_name);
+      send_message();
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::drop_item(
+      const std::string& item_name) {
+    auto& inventory = _player->get_mutable_inventory();
+    if (const auto item = inventory.find(item_name)) {
+      render().format("You drop the {}. It fades away in the darkness.\n",
+                      item_name);
+      send_message();
+      // The player saw the item fall, so it stays revealed.
+      _map->put_item(_player->get_current_room(),
+                     inventory.remove(item.value()));
+    } else {
+      render().format("You can't drop the {}!\n", item_name);
+      send_message();
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::travel_to(
+      const RoomName& destination) {
+    const auto target = _map->find_room(destination);
+    if (!target.has_value()) {
+      render().format("There is no {} to go to.\n", destination);
+      send_message();
+      return;
+    }
+    const auto from = _player->get_current_room();
+    const auto route = _router ? _router->route(from, target.value())
+                               : find_route(*_map, from, target.value());
+    if (!route.has_value()) {
+      render().format("You find no way to {}.\n", destination);
+      send_message();
+      return;
+    }
+    if (route->empty()) {
+      render().format("You are already in {}.\n", destination);
+      send_message();
+      return;
+    }
+
+    // One change of room and one message, however long the route.
+    auto room = from;
+    auto& message = render();
+    for (const auto direction : route.value()) {
+      const auto next = _map->next_room(room, direction);
+      if (!next.has_value()) {
+        break;
+      }
+      if (room != from) {
+        message.append(message.empty() ? "You pass through " : ", ")
+            .append(_map->get_room_name(room));
+      }
+      room = next.value();
+    }
+    if (!message.empty()) {
+      message.append(".\n");
+    }
+    message.append(_map->get_welcome_message(room));
+    _player->change_room(room);
+    send_message();
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  bool BasicGame<MapT, PlayerT, InputT>::perform(Action action,
+                                                 Direction direction,
+                                                 const std::string& name) {
+    switch (action) {
+      case Action::Quit: {
+        record(action);
+        return false;
+      }
+      case Action::Move: {
+        record(action, direction);
+        move(direction);
+        break;
+      }
+      case Action::Investigate: {
+        record(action);
+        render().format("Investigating {}",
+                        _map->get_room_name(_player->get_current_room()));
+        send_message();
+        investigate();
+        break;
+      }
+      case Action::TakeItem: {
+        record(action, name);
+        take_item(name);
+        break;
+      }
+      case Action::UseItem: {
+        record(action, name);
+        use_item(name);
+        break;
+      }
+      case Action::DropItem: {
+        record(action, name);
+        drop_item(name);
+        break;
+      }
+      case Action::TravelTo: {
+        record(action, name);
+        travel_to(name);
+        break;
+      }
+      case Action::DisplayInventory: {
+        record(action);
+        display_player_inventory();
+        break;
+      }
+      default: {
+        provide(game_detail::UNKNOWN_COMMAND);
+      };
+    }
+    return true;
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  DirectionSet BasicGame<MapT, PlayerT, InputT>::get_available_directions()
+      const {
+    return _map->available_exits(_player->get_current_room());
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::provide(std::string_view text) {
+    if (_input_handler) {
+      _input_handler->provide_message(text);
+    } else if (_async_input) {
+      _async_input->provide_message(text);
+    }
+  }
+
+  template <typename MapT, typename PlayerT, typename InputT>
+  void BasicGame<MapT, PlayerT, InputT>::update_message(
+      std::string_view message) {
+    render().append(message);
+    send_message();
+  }
+
 }  // namespace adv_sk
@@ -2,19 +2,26 @@
 
 #include "Game.hpp"
 
-#include "Direction.hpp"         // for Direction
+#include "ActionScript.hpp"          // for ScriptStep
+#include "AllocationCounter.hpp"     // for AllocationCounter
+#include "Direction.hpp"             // for Direction, DirectionSet
+#include "HeadlessInputHandler.hpp"  // for HeadlessInputHandler
 #include "IInputHandler.hpp"     // for Action, IInputHandler
 #include "IMap.hpp"              // for IMap
 #include "IPlayer.hpp"           // for IPlayer
-#include "Inventory.hpp"         // for InventoryItem
-#include "MockInputHandler.hpp"  // for MockInputHandler
-#include "MockMap.hpp"           // for MockMap
-#include "MockPlayer.hpp"        // for MockPlayer
-#include "Room.hpp"              // for Room
-#include "Types.hpp"             // for RoomName
-#include "gmock/gmock.h"         // for NiceMock, Return, ReturnRef
-#include "gtest/gtest.h"         // for TEST_F, EXPECT_CALL
-
+#include "Inventory.hpp"             // for Inventory, InventoryItem
+#include "Map.hpp"                   // for Map, create_map
+#include "MockInputHandler.hpp"      // for MockInputHandler
+#include "MockMap.hpp"               // for MockMap
+#include "MockPlayer.hpp"            // for MockPlayer
+#include "Player.hpp"                // for Player
+#include "Room.hpp"                  // for Room
+#include "SyncInputAdapter.hpp"      // for SyncInputAdapter
+#include "Types.hpp"                 // for RoomId
+#include "gmock/gmock.h"             // for NiceMock, Return, ReturnRef
+#include "gtest/gtest.h"             // for TEST_F, EXPECT_CALL
+
+#include <cstddef>   // for size_t
 #include <memory>    // for unique_ptr, make_unique
 #include <optional>  // for optional, nullopt
 #include <string>    // for string
@@ -24,10 +31,17 @@
 namespace adv_sk::test {
 
   using ::testing::_;
+  using ::testing::An;
   using ::testing::NiceMock;
   using ::testing::Return;
   using ::testing::ReturnRef;
 
+  namespace {
+    constexpr RoomId GRAND_HALL = 0;
+    constexpr RoomId ARMOURY = 1;
+    constexpr RoomId TEST_ROOM = 2;
+  }  // namespace
+
   // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes,misc-non-private-member-variables-in-classes)
   class GameTest : public ::testing::Test {
    protected:
@@ -40,9 +54,11 @@ namespace adv_sk::test {
       mock_player = player.get();
       mock_input = input.get();
 
+      ON_CALL(*mock_map, find_room("GrandHall"))
+          .WillByDefault(Return(GRAND_HALL));
       ON_CALL(*mock_player, get_current_room())
-          .WillByDefault(Return("GrandHall"));
-      ON_CALL(*mock_map, get_welcome_message(_))
+          .WillByDefault(Return(GRAND_HALL));
+      ON_CALL(*mock_map, get_welcome_message(An<RoomId>()))
           .WillByDefault(Return("Welcome to GrandHall"));
 
       game = std::make_unique<Game>(std::move(map), std::move(player),
@@ -64,11 +80,14 @@ namespace adv_sk::test {
     auto* map_ptr = map.get();
     auto* input_ptr = input.get();
 
-    ON_CALL(*player_ptr, get_current_room()).WillByDefault(Return("GrandHall"));
-    ON_CALL(*map_ptr, get_welcome_message(_)).WillByDefault(Return("Welcome"));
+    ON_CALL(*map_ptr, find_room("GrandHall")).WillByDefault(Return(GRAND_HALL));
+    ON_CALL(*player_ptr, get_current_room()).WillByDefault(Return(GRAND_HALL));
+    ON_CALL(*map_ptr, get_welcome_message(An<RoomId>()))
+        .WillByDefault(Return("Welcome"));
 
-    EXPECT_CALL(*player_ptr, change_room("GrandHall")).Times(1);
-    EXPECT_CALL(*map_ptr, get_welcome_message("GrandHall")).Times(1);
+    EXPECT_CALL(*map_ptr, find_room("GrandHall")).Times(1);
+    EXPECT_CALL(*player_ptr, change_room(GRAND_HALL)).Times(1);
+    EXPECT_CALL(*map_ptr, get_welcome_message(GRAND_HALL)).Times(1);
     EXPECT_CALL(*input_ptr, provide_message("Welcome")).Times(1);
 
     const Game game_obj(std::move(map), std::move(player), std::move(input));
@@ -78,12 +97,12 @@ namespace adv_sk::test {
 
   TEST_F(GameTest, moveToValidRoomChangesPlayerRoom) {
     EXPECT_CALL(*mock_player, get_current_room())
-        .WillOnce(Return("GrandHall"))
-        .WillOnce(Return("Armoury"));
-    EXPECT_CALL(*mock_map, next_room("GrandHall", Direction::North))
-        .WillOnce(Return(std::optional<RoomName>("Armoury")));
-    EXPECT_CALL(*mock_player, change_room("Armoury"));
-    EXPECT_CALL(*mock_map, get_welcome_message("Armoury"))
+        .WillOnce(Return(GRAND_HALL))
+        .WillOnce(Return(ARMOURY));
+    EXPECT_CALL(*mock_map, next_room(GRAND_HALL, Direction::North))
+        .WillOnce(Return(std::optional<RoomId>(ARMOURY)));
+    EXPECT_CALL(*mock_player, change_room(ARMOURY));
+    EXPECT_CALL(*mock_map, get_welcome_message(ARMOURY))
         .WillOnce(Return("Welcome to Armoury"));
     EXPECT_CALL(*mock_input, provide_message("Welcome to Armoury"));
 
@@ -91,8 +110,8 @@ namespace adv_sk::test {
   }
 
   TEST_F(GameTest, moveToInvalidDirectionShowsError) {
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("GrandHall"));
-    EXPECT_CALL(*mock_map, next_room("GrandHall", Direction::South))
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(GRAND_HALL));
+    EXPECT_CALL(*mock_map, next_room(GRAND_HALL, Direction::South))
         .WillOnce(Return(std::nullopt));
     EXPECT_CALL(*mock_input, provide_message("Wrong direction!\n"));
 
@@ -102,20 +121,20 @@ namespace adv_sk::test {
   // --- investigate() tests ---
 
   TEST_F(GameTest, investigateRevealsItems) {
-    Room room("TestRoom", "msg", {InventoryItem{.name = "sword"}});
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("TestRoom"));
-    EXPECT_CALL(*mock_map, get_room("TestRoom")).WillOnce(ReturnRef(room));
+    Room room("TestRoom", "msg", {InventoryItem("sword")});
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
     EXPECT_CALL(*mock_input,
                 provide_message("You search the room. You found a sword!\n"));
 
     game->investigate();
-    EXPECT_TRUE(room.inventory()[0].is_visible);
+    EXPECT_TRUE(room.inventory().is_visible(0));
   }
 
   TEST_F(GameTest, investigateEmptyRoomShowsNothing) {
     Room room("TestRoom", "msg");
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("TestRoom"));
-    EXPECT_CALL(*mock_map, get_room("TestRoom")).WillOnce(ReturnRef(room));
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
     EXPECT_CALL(*mock_input,
                 provide_message("You search the room. Nothing found!\n"));
 
@@ -125,11 +144,10 @@ namespace adv_sk::test {
   // --- take_item() tests ---
 
   TEST_F(GameTest, takeVisibleItemAddsToPlayerInventory) {
-    const InventoryItem sword{
-        .name = "sword", .use_message = "", .is_visible = true};
-    Room room("R", "", {sword});
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("R"));
-    EXPECT_CALL(*mock_map, get_room("R")).WillOnce(ReturnRef(room));
+    Room room("R", "");
+    room.add_to_inventory(InventoryItem("sword"), true);
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
     EXPECT_CALL(*mock_input, provide_message("You take the sword\n"));
     EXPECT_CALL(*mock_player, add_to_inventory(_));
 
@@ -138,11 +156,10 @@ namespace adv_sk::test {
   }
 
   TEST_F(GameTest, takeInvisibleItemFails) {
-    const InventoryItem sword{
-        .name = "sword", .use_message = "", .is_visible = false};
+    const InventoryItem sword("sword");
     Room room("R", "", {sword});
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("R"));
-    EXPECT_CALL(*mock_map, get_room("R")).WillOnce(ReturnRef(room));
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
     EXPECT_CALL(*mock_input, provide_message("You can't take the sword\n"));
 
     game->take_item("sword");
@@ -150,8 +167,8 @@ namespace adv_sk::test {
 
   TEST_F(GameTest, takeNonexistentItemFails) {
     Room room("R", "");
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("R"));
-    EXPECT_CALL(*mock_map, get_room("R")).WillOnce(ReturnRef(room));
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
     EXPECT_CALL(*mock_input, provide_message("You can't take the ghost\n"));
 
     game->take_item("ghost");
@@ -160,9 +177,7 @@ namespace adv_sk::test {
   // --- use_item() tests ---
 
   TEST_F(GameTest, useItemInInventoryShowsMessage) {
-    std::vector<InventoryItem> inv{{.name = "potion",
-                                    .use_message = "You drink it!\n",
-                                    .is_visible = true}};
+    Inventory inv{InventoryItem("potion", "You drink it!\n")};
     EXPECT_CALL(*mock_player, get_mutable_inventory()).WillOnce(ReturnRef(inv));
     EXPECT_CALL(*mock_input, provide_message("You drink it!\n"));
 
@@ -171,7 +186,7 @@ namespace adv_sk::test {
   }
 
   TEST_F(GameTest, useItemNotInInventoryFails) {
-    std::vector<InventoryItem> inv;
+    Inventory inv;
     EXPECT_CALL(*mock_player, get_mutable_inventory()).WillOnce(ReturnRef(inv));
     EXPECT_CALL(*mock_input, provide_message("You can't use the ghost!\n"));
 
@@ -181,24 +196,23 @@ namespace adv_sk::test {
   // --- drop_item() tests ---
 
   TEST_F(GameTest, dropItemMovesToRoom) {
-    const InventoryItem sword{
-        .name = "sword", .use_message = "", .is_visible = true};
-    std::vector<InventoryItem> inv{sword};
+    Inventory inv{InventoryItem("sword")};
     Room room("R");
     EXPECT_CALL(*mock_player, get_mutable_inventory()).WillOnce(ReturnRef(inv));
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("R"));
-    EXPECT_CALL(*mock_map, get_room("R")).WillOnce(ReturnRef(room));
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
     EXPECT_CALL(*mock_input,
                 provide_message(
                     "You drop the sword. It fades away in the darkness.\n"));
 
     game->drop_item("sword");
     EXPECT_TRUE(inv.empty());
-    EXPECT_EQ(room.inventory().size(), 1);
+    ASSERT_EQ(room.inventory().size(), 1);
+    EXPECT_TRUE(room.inventory().is_visible(0));
   }
 
   TEST_F(GameTest, dropItemNotInInventoryFails) {
-    std::vector<InventoryItem> inv;
+    Inventory inv;
     EXPECT_CALL(*mock_player, get_mutable_inventory()).WillOnce(ReturnRef(inv));
     EXPECT_CALL(*mock_input, provide_message("You can't drop the ghost!\n"));
 
@@ -208,7 +222,7 @@ namespace adv_sk::test {
   // --- display_player_inventory() tests ---
 
   TEST_F(GameTest, displayInventoryShowsItems) {
-    std::vector<InventoryItem> inv{{.name = "sword"}, {.name = "shield"}};
+    Inventory inv{InventoryItem("sword"), InventoryItem("shield")};
     EXPECT_CALL(*mock_player, get_inventory()).WillOnce(ReturnRef(inv));
     EXPECT_CALL(*mock_input,
                 provide_message("Your inventory contains: sword shield.\n"));
@@ -217,7 +231,7 @@ namespace adv_sk::test {
   }
 
   TEST_F(GameTest, displayEmptyInventory) {
-    std::vector<InventoryItem> inv;
+    Inventory inv;
     EXPECT_CALL(*mock_player, get_inventory()).WillOnce(ReturnRef(inv));
     EXPECT_CALL(*mock_input, provide_message("Your inventory contains:.\n"));
 
@@ -227,27 +241,21 @@ namespace adv_sk::test {
   // --- get_available_directions() tests ---
 
   TEST_F(GameTest, getAvailableDirectionsReturnsValidOnes) {
-    EXPECT_CALL(*mock_player, get_current_room())
-        .WillRepeatedly(Return("GrandHall"));
-    EXPECT_CALL(*mock_map, next_room("GrandHall", Direction::North))
-        .WillOnce(Return(std::optional<RoomName>("Armoury")));
-    EXPECT_CALL(*mock_map, next_room("GrandHall", Direction::South))
-        .WillOnce(Return(std::nullopt));
-    EXPECT_CALL(*mock_map, next_room("GrandHall", Direction::East))
-        .WillOnce(Return(std::nullopt));
-    EXPECT_CALL(*mock_map, next_room("GrandHall", Direction::West))
-        .WillOnce(Return(std::nullopt));
+    DirectionSet exits;
+    exits.insert(Direction::North);
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(GRAND_HALL));
+    EXPECT_CALL(*mock_map, available_exits(GRAND_HALL)).WillOnce(Return(exits));
+    EXPECT_CALL(*mock_map, next_room(An<RoomId>(), _)).Times(0);
 
     auto dirs = game->get_available_directions();
     ASSERT_EQ(dirs.size(), 1);
-    EXPECT_EQ(dirs[0], Direction::North);
+    EXPECT_EQ(*dirs.begin(), Direction::North);
   }
 
   TEST_F(GameTest, getAvailableDirectionsReturnsEmpty) {
-    EXPECT_CALL(*mock_player, get_current_room())
-        .WillRepeatedly(Return("Isolated"));
-    EXPECT_CALL(*mock_map, next_room("Isolated", _))
-        .WillRepeatedly(Return(std::nullopt));
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, available_exits(TEST_ROOM))
+        .WillOnce(Return(DirectionSet{}));
 
     auto dirs = game->get_available_directions();
     EXPECT_TRUE(dirs.empty());
@@ -256,7 +264,9 @@ namespace adv_sk::test {
   // --- get_current_location() ---
 
   TEST_F(GameTest, getCurrentLocationDelegatesToPlayer) {
-    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return("TestRoom"));
+    EXPECT_CALL(*mock_player, get_current_room()).WillOnce(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room_name(TEST_ROOM))
+        .WillOnce(Return("TestRoom"));
 
     EXPECT_EQ(game->get_current_location(), "TestRoom");
   }
@@ -271,12 +281,12 @@ namespace adv_sk::test {
 
   TEST_F(GameTest, handleUserActionMoveCallsSequence) {
     EXPECT_CALL(*mock_input, get_action()).WillOnce(Return(Action::Move));
-    EXPECT_CALL(*mock_input, provide_directions(_));
+    EXPECT_CALL(*mock_input, provide_directions(An<DirectionSet>()));
     EXPECT_CALL(*mock_input, get_direction())
         .WillOnce(Return(Direction::North));
     EXPECT_CALL(*mock_player, get_current_room())
-        .WillRepeatedly(Return("GrandHall"));
-    EXPECT_CALL(*mock_map, next_room(_, _))
+        .WillRepeatedly(Return(GRAND_HALL));
+    EXPECT_CALL(*mock_map, next_room(An<RoomId>(), _))
         .WillRepeatedly(Return(std::nullopt));
 
     EXPECT_TRUE(game->handle_user_action());
@@ -286,8 +296,9 @@ namespace adv_sk::test {
     Room room("R");
     EXPECT_CALL(*mock_input, get_action())
         .WillOnce(Return(Action::Investigate));
-    EXPECT_CALL(*mock_player, get_current_room()).WillRepeatedly(Return("R"));
-    EXPECT_CALL(*mock_map, get_room("R")).WillOnce(ReturnRef(room));
+    EXPECT_CALL(*mock_player, get_current_room())
+        .WillRepeatedly(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
 
     EXPECT_TRUE(game->handle_user_action());
   }
@@ -296,14 +307,15 @@ namespace adv_sk::test {
     Room room("R");
     EXPECT_CALL(*mock_input, get_action()).WillOnce(Return(Action::TakeItem));
     EXPECT_CALL(*mock_input, get_item_name()).WillOnce(Return("sword"));
-    EXPECT_CALL(*mock_player, get_current_room()).WillRepeatedly(Return("R"));
-    EXPECT_CALL(*mock_map, get_room("R")).WillOnce(ReturnRef(room));
+    EXPECT_CALL(*mock_player, get_current_room())
+        .WillRepeatedly(Return(TEST_ROOM));
+    EXPECT_CALL(*mock_map, get_room(TEST_ROOM)).WillOnce(ReturnRef(room));
 
     EXPECT_TRUE(game->handle_user_action());
   }
 
   TEST_F(GameTest, handleUserActionUseItem) {
-    std::vector<InventoryItem> inv;
+    Inventory inv;
     EXPECT_CALL(*mock_input, get_action()).WillOnce(Return(Action::UseItem));
     EXPECT_CALL(*mock_input, get_item_name()).WillOnce(Return("potion"));
     EXPECT_CALL(*mock_player, get_mutable_inventory()).WillOnce(ReturnRef(inv));
@@ -312,7 +324,7 @@ namespace adv_sk::test {
   }
 
   TEST_F(GameTest, handleUserActionDropItem) {
-    std::vector<InventoryItem> inv;
+    Inventory inv;
     EXPECT_CALL(*mock_input, get_action()).WillOnce(Return(Action::DropItem));
     EXPECT_CALL(*mock_input, get_item_name()).WillOnce(Return("sword"));
     EXPECT_CALL(*mock_player, get_mutable_inventory()).WillOnce(ReturnRef(inv));
@@ -321,7 +333,7 @@ namespace adv_sk::test {
   }
 
   TEST_F(GameTest, handleUserActionDisplayInventory) {
-    std::vector<InventoryItem> inv;
+    Inventory inv;
     EXPECT_CALL(*mock_input, get_action())
         .WillOnce(Return(Action::DisplayInventory));
     EXPECT_CALL(*mock_player, get_inventory()).WillOnce(ReturnRef(inv));
@@ -342,4 +354,108 @@ namespace adv_sk::test {
     empty_game.start();
   }
 
+  // --- run() tests ---
+
+  TEST(GameRun, drivesSynchronousMockThroughAdapter) {
+    auto map = std::make_unique<NiceMock<MockMap>>();
+    auto player = std::make_unique<NiceMock<MockPlayer>>();
+    auto input = std::make_unique<NiceMock<MockInputHandler>>();
+    auto* map_ptr = map.get();
+    auto* player_ptr = player.get();
+    auto* input_ptr = input.get();
+
+    ON_CALL(*map_ptr, find_room("GrandHall")).WillByDefault(Return(GRAND_HALL));
+    ON_CALL(*player_ptr, get_current_room()).WillByDefault(Return(GRAND_HALL));
+    ON_CALL(*map_ptr, get_welcome_message(An<RoomId>()))
+        .WillByDefault(Return("Welcome"));
+    EXPECT_CALL(*input_ptr, provide_message("Welcome"));
+    EXPECT_CALL(*input_ptr, get_action())
+        .WillOnce(Return(Action::Move))
+        .WillOnce(Return(Action::Quit));
+    EXPECT_CALL(*input_ptr, provide_directions(An<DirectionSet>()));
+    EXPECT_CALL(*input_ptr, get_direction()).WillOnce(Return(Direction::East));
+    EXPECT_CALL(*map_ptr, next_room(GRAND_HALL, Direction::East))
+        .WillOnce(Return(std::nullopt));
+    EXPECT_CALL(*input_ptr, provide_message("Wrong direction!\n"));
+
+    Game game(std::move(map), std::move(player),
+              std::make_unique<SyncInputAdapter>(std::move(input)));
+    auto session = game.run();
+    EXPECT_FALSE(session.done());
+    session.resume();
+    EXPECT_TRUE(session.done());
+  }
+
+  TEST(GameDefaultConstruction, runWithoutAsyncInputFinishes) {
+    Game empty_game;
+    auto session = empty_game.run();
+    session.resume();
+    EXPECT_TRUE(session.done());
+  }
+
+  // --- Message rendering tests ---
+
+  TEST(GameMessages, handlerSeesTheRenderedReply) {
+    auto input = std::make_unique<NiceMock<MockInputHandler>>();
+    EXPECT_CALL(*input, provide_message(_)).Times(::testing::AnyNumber());
+    EXPECT_CALL(*input, provide_message("You can't drop the lamp!\n"));
+    Game game(create_map(), std::make_unique<Player>(), std::move(input));
+    game.drop_item("lamp");
+    EXPECT_EQ(game.get_current_message(), "You can't drop the lamp!\n");
+  }
+
+  TEST(GameMessages, steadyStateActionsDoNotAllocate) {
+    const std::vector<ScriptStep> round{
+        {.action = Action::Investigate},
+        {.action = Action::TakeItem, .item_name = "golden chalice"},
+        {.action = Action::DisplayInventory},
+        {.action = Action::DropItem, .item_name = "golden chalice"},
+        {.action = Action::TakeItem, .item_name = "lamp"},
+        {.action = Action::Move, .direction = Direction::North},
+        {.action = Action::Move, .direction = Direction::West},
+        {.action = Action::Investigate},
+        {.action = Action::Move, .direction = Direction::South},
+    };
+    // The first round grows the buffers; the second reuses them.
+    std::vector<ScriptStep> script(round);
+    script.insert(script.end(), round.begin(), round.end());
+    Game game(create_map(), std::make_unique<Player>(),
+              std::make_unique<HeadlessInputHandler>(script));
+    for (std::size_t step = 0; step < round.size(); ++step) {
+      ASSERT_TRUE(game.handle_user_action());
+    }
+
+    const AllocationCounter allocations;
+    for (std::size_t step = 0; step < round.size(); ++step) {
+      static_cast<void>(game.handle_user_action());
+    }
+    EXPECT_EQ(allocations.count(), 0);
+  }
+
+  // --- Static dispatch tests ---
+
+  TEST(BasicGame, concreteGamePlaysLikeTheVirtualOne) {
+    const std::vector<ScriptStep> script{
+        {.action = Action::Investigate},
+        {.action = Action::TakeItem, .item_name = "golden chalice"},
+        {.action = Action::Move, .direction = Direction::North},
+        {.action = Action::DisplayInventory},
+        {.action = Action::UseItem, .item_name = "golden chalice"},
+    };
+    std::string virtual_transcript;
+    Game virtual_game(
+        create_map(), std::make_unique<Player>(),
+        std::make_unique<HeadlessInputHandler>(script, &virtual_transcript));
+    virtual_game.start();
+
+    std::string static_transcript;
+    BasicGame<Map, Player, HeadlessInputHandler> static_game(
+        create_map(), std::make_unique<Player>(),
+        std::make_unique<HeadlessInputHandler>(script, &static_transcript));
+    static_game.start();
+
+    EXPECT_EQ(static_transcript, virtual_transcript);
+    EXPECT_EQ(static_game.get_current_location(), "Armoury");
+  }
+
 }  // namespace adv_sk::test
@@ -0,0 +1,37 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "HeadlessInputHandler.hpp"
+
+namespace adv_sk {
+
+  Action HeadlessInputHandler::get_action() {
+    if (_next == _script.size()) {
+      return Action::Quit;
+    }
+    return _script[_next++].action;
+  }
+
+  void HeadlessInputHandler::provide_directions(DirectionSet /*directions*/) {
+  }
+
+  std::optional<Direction> HeadlessInputHandler::get_direction() {
+    return _script[_next - 1].direction;
+  }
+
+  std::string HeadlessInputHandler::get_item_name() {
+    return _script[_next - 1].item_name;
+  }
+
+  std::string HeadlessInputHandler::get_room_name() {
+    return _script[_next - 1].room_name;
+  }
+
+  void HeadlessInputHandler::provide_message(std::string_view message) {
+    if (_transcript != nullptr) {
+      _transcript->append(message).push_back('\n');
+    }
+  }
+
+}  // namespace adv_sk
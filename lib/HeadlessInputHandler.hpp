@@ -0,0 +1,51 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "ActionScript.hpp"   // for ScriptStep
+#include "Direction.hpp"      // for Direction, DirectionSet
+#include "IInputHandler.hpp"  // for IInputHandler, Action
+
+#include <cstddef>      // for size_t
+#include <span>         // for span
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace adv_sk {
+
+  /**
+   * @brief IInputHandler that plays a script without touching the console.
+   *
+   * Once the script runs out every further action is Action::Quit. Messages
+   * are appended, newline-terminated, to `transcript` when one is given and
+   * dropped otherwise; prompts listing directions are never rendered.
+   */
+  class HeadlessInputHandler final : public IInputHandler {
+   public:
+    explicit HeadlessInputHandler(std::span<const ScriptStep> script,
+                                  std::string* transcript = nullptr)
+        : _script(script), _transcript(transcript) {
+    }
+
+    Action get_action() override;
+    void provide_directions(DirectionSet directions) override;
+    std::optional<Direction> get_direction() override;
+    std::string get_item_name() override;
+    std::string get_room_name() override;
+    void provide_message(std::string_view message) override;
+
+    /// Script steps handed out so far, not counting the final Quit.
+    [[nodiscard]] std::size_t actions_taken() const {
+      return _next;
+    }
+
+   private:
+    std::span<const ScriptStep> _script;
+    std::string* _transcript;
+    std::size_t _next{0};
+  };
+
+}  // namespace adv_sk
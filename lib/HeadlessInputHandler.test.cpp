@@ -0,0 +1,45 @@
+// HeadlessInputHandler unit tests
+
+#include "HeadlessInputHandler.hpp"
+
+#include "ActionScript.hpp"   // for ScriptStep
+#include "Direction.hpp"      // for Direction
+#include "IInputHandler.hpp"  // for Action
+#include "gtest/gtest.h"      // for TEST, EXPECT_EQ
+
+#include <string>  // for string
+#include <vector>  // for vector
+
+namespace adv_sk::test {
+
+  TEST(HeadlessInputHandler, replaysScriptThenQuits) {
+    const std::vector<ScriptStep> script{
+        {.action = Action::Move, .direction = Direction::East},
+        {.action = Action::TakeItem, .item_name = "sword"},
+    };
+    HeadlessInputHandler handler(script);
+
+    EXPECT_EQ(handler.get_action(), Action::Move);
+    EXPECT_EQ(handler.get_direction(), Direction::East);
+    EXPECT_EQ(handler.get_action(), Action::TakeItem);
+    EXPECT_EQ(handler.get_item_name(), "sword");
+    EXPECT_EQ(handler.get_action(), Action::Quit);
+    EXPECT_EQ(handler.get_action(), Action::Quit);
+    EXPECT_EQ(handler.actions_taken(), 2);
+  }
+
+  TEST(HeadlessInputHandler, collectsMessagesIntoTranscript) {
+    std::string transcript;
+    HeadlessInputHandler handler({}, &transcript);
+    handler.provide_message("Hello");
+    handler.provide_message("World");
+    EXPECT_EQ(transcript, "Hello\nWorld\n");
+  }
+
+  TEST(HeadlessInputHandler, discardsMessagesWithoutTranscript) {
+    HeadlessInputHandler handler({});
+    handler.provide_message("Hello");
+    EXPECT_EQ(handler.get_action(), Action::Quit);
+  }
+
+}  // namespace adv_sk::test
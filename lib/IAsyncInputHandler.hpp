@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Direction.hpp"      // for Direction, DirectionSet
+#include "IInputHandler.hpp"  // for Action
+#include "Task.hpp"           // for Task
+
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace adv_sk {
+
+  /**
+   * @brief Input interface for Game::run().
+   *
+   * Reads are coroutines, so a game waiting for a player is a suspended
+   * frame rather than a blocked thread. Output never waits and stays
+   * synchronous.
+   */
+  class IAsyncInputHandler {
+   public:
+    virtual ~IAsyncInputHandler() = default;
+
+    virtual Task<Action> get_action() = 0;
+    virtual void provide_directions(DirectionSet directions) = 0;
+    /// std::nullopt once the input has ended; the game then quits.
+    virtual Task<std::optional<Direction>> get_direction() = 0;
+    virtual Task<std::string> get_item_name() = 0;
+    virtual Task<std::string> get_room_name() = 0;
+
+    /// `message` views the game's reply buffer; copy it to keep it.
+    virtual void provide_message(std::string_view message) = 0;
+
+    /// Asks for an action's argument; shown like any other message unless
+    /// the handler has no one to ask.
+    virtual void provide_prompt(std::string_view prompt) {
+      provide_message(prompt);
+    }
+  };
+
+}  // namespace adv_sk
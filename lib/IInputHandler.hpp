@@ -1,10 +1,11 @@
 #pragma once
 
-#include "Direction.hpp"  // for Direction
+#include "Direction.hpp"  // for Direction, DirectionSet
 
-#include <cstdint>  // for uint8_t
-#include <string>   // for string
-#include <vector>   // for vector
+#include <cstdint>      // for uint8_t
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
 
 namespace adv_sk {
 
@@ -15,6 +16,8 @@ namespace adv_sk {
     DisplayInventory,
     UseItem,
     DropItem,
+    /// Walks a shortest route to a named room in one command.
+    TravelTo,
     Quit,
   };
 
@@ -23,12 +26,20 @@ namespace adv_sk {
     virtual ~IInputHandler() = default;
 
     virtual Action get_action() = 0;
-    virtual void provide_directions(
-        const std::vector<Direction>& directions) = 0;
-    virtual Direction get_direction() = 0;
+    virtual void provide_directions(DirectionSet directions) = 0;
+    /// std::nullopt once the input has ended; the game then quits.
+    virtual std::optional<Direction> get_direction() = 0;
     virtual std::string get_item_name() = 0;
+    virtual std::string get_room_name() = 0;
 
-    virtual void provide_message(const std::string& message) = 0;
+    /// `message` views the game's reply buffer; copy it to keep it.
+    virtual void provide_message(std::string_view message) = 0;
+
+    /// Asks for an action's argument; shown like any other message unless
+    /// the handler has no one to ask.
+    virtual void provide_prompt(std::string_view prompt) {
+      provide_message(prompt);
+    }
   };
 
 }  // namespace adv_sk
@@ -0,0 +1,34 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "IMap.hpp"
+
+#include "Inventory.hpp"  // for Inventory, InventoryItem
+#include "Room.hpp"       // for Room
+
+namespace adv_sk {
+
+  std::size_t IMap::reveal_items(RoomId room, const ItemVisitor& visit) {
+    auto& inventory = get_room(room).inventory();
+    inventory.reveal_all();
+    for (const auto& item : inventory) {
+      visit(item);
+    }
+    return inventory.size();
+  }
+
+  std::optional<InventoryItem> IMap::take_visible_item(
+      RoomId room, std::string_view name) {
+    auto& inventory = get_room(room).inventory();
+    if (const auto item = inventory.find_visible(name)) {
+      return inventory.remove(item.value());
+    }
+    return std::nullopt;
+  }
+
+  void IMap::put_item(RoomId room, const InventoryItem& item) {
+    get_room(room).add_to_inventory(item, true);
+  }
+
+}  // namespace adv_sk
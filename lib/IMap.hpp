@@ -1,27 +1,62 @@
 #pragma once
 
-#include "Types.hpp"  // for RoomName
+#include "Direction.hpp"  // for Direction, DirectionSet
+#include "Types.hpp"      // for RoomName, RoomId
 
-#include <cstdint>   // for uint8_t
-#include <optional>  // for optional
-#include <string>    // for string
+#include <cstddef>      // for size_t
+#include <functional>   // for function
+#include <optional>     // for optional
+#include <string_view>  // for string_view
 
 namespace adv_sk {
 
-  enum class Direction : std::uint8_t;
   class Room;
+  struct InventoryItem;
+
+  /// Called with each item of a room, in listing order.
+  using ItemVisitor = std::function<void(const InventoryItem&)>;
 
   class IMap {
    public:
     virtual ~IMap() = default;
 
-    virtual std::optional<RoomName> next_room(const RoomName& current_room,
-                                              Direction direction) = 0;
+    [[nodiscard]] virtual std::optional<RoomId> find_room(
+        const RoomName& room) const = 0;
+
+    virtual std::optional<std::string_view> next_room(
+        const RoomName& current_room, Direction direction) = 0;
 
-    [[nodiscard]] virtual std::string get_welcome_message(
+    virtual std::optional<RoomId> next_room(RoomId current_room,
+                                            Direction direction) = 0;
+
+    /// All exits of a room, answered with a single lookup.
+    [[nodiscard]] virtual DirectionSet available_exits(RoomId room) const = 0;
+
+    [[nodiscard]] virtual std::string_view get_welcome_message(
         const RoomName& room) const = 0;
 
+    [[nodiscard]] virtual std::string_view get_welcome_message(
+        RoomId room) const = 0;
+
+    [[nodiscard]] virtual std::string_view get_room_name(
+        RoomId room) const = 0;
+
     [[nodiscard]] virtual Room& get_room(const RoomName& room) = 0;
+
+    [[nodiscard]] virtual Room& get_room(RoomId room) = 0;
+
+    // The item changes the game makes. They go through get_room() unless a
+    // map keeps a room's items apart from the room, as SessionMap does.
+
+    /// Reveals every item in the room and visits each; returns how many.
+    virtual std::size_t reveal_items(RoomId room, const ItemVisitor& visit);
+
+    /// Takes out the first listed visible item named `name`, if any.
+    virtual std::optional<InventoryItem> take_visible_item(
+        RoomId room, std::string_view name);
+
+    /// Puts an item into the room, revealed.
+    virtual void put_item(RoomId room, const InventoryItem& item);
   };
 
 }  // namespace adv_sk
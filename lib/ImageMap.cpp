@@ -0,0 +1,60 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "ImageMap.hpp"
+
+#include <stdexcept>  // for invalid_argument, out_of_range
+#include <utility>    // for move
+
+namespace adv_sk {
+
+  ImageMap::ImageMap(SharedWorldImage world) : _world(std::move(world)) {
+    if (!_world) {
+      throw std::invalid_argument("ImageMap needs a world image");
+    }
+  }
+
+  RoomId ImageMap::id_of(const RoomName& room) const {
+    const auto room_id = _world->find_room(room);
+    if (!room_id.has_value()) {
+      throw std::out_of_range("Unknown room: " + room);
+    }
+    return room_id.value();
+  }
+
+  std::optional<std::string_view> ImageMap::next_room(
+      const RoomName& current_room, Direction direction) {
+    const auto next = next_room(id_of(current_room), direction);
+    if (!next.has_value()) {
+      return std::nullopt;
+    }
+    return _world->room_name(next.value());
+  }
+
+  std::optional<RoomId> ImageMap::next_room(RoomId current_room,
+                                            Direction direction) {
+    const auto next = _world->exit_target(current_room, direction);
+    if (next == INVALID_ROOM_ID) {
+      return std::nullopt;
+    }
+    return next;
+  }
+
+  std::string_view ImageMap::get_welcome_message(const RoomName& room) const {
+    return _world->room_message(id_of(room));
+  }
+
+  Room& ImageMap::get_room(const RoomName& room) {
+    return get_room(id_of(room));
+  }
+
+  Room& ImageMap::get_room(RoomId room) {
+    if (const auto loaded = _loaded_rooms.find(room);
+        loaded != _loaded_rooms.end()) {
+      return loaded->second;
+    }
+    return _loaded_rooms.emplace(room, _world->make_room(room)).first->second;
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,76 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"   // for Direction, DirectionSet
+#include "IMap.hpp"        // for IMap
+#include "Room.hpp"        // for Room
+#include "Types.hpp"       // for RoomName, RoomId
+#include "WorldImage.hpp"  // for SharedWorldImage
+
+#include <cstddef>        // for size_t
+#include <optional>       // for optional
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+
+namespace adv_sk {
+
+  /**
+   * @brief One session's IMap over a compiled world image.
+   *
+   * Lookups, exits, names and messages are answered from the mapped image.
+   * get_room() copies a room out of the image the first time it is asked
+   * for and keeps that copy for the session, much as SessionMap keeps a
+   * room's changes over a shared Map.
+   */
+  class ImageMap : public IMap {
+   public:
+    explicit ImageMap(SharedWorldImage world);
+
+    [[nodiscard]] std::optional<RoomId> find_room(
+        const RoomName& room) const override {
+      return _world->find_room(room);
+    }
+
+    std::optional<std::string_view> next_room(const RoomName& current_room,
+                                              Direction direction) override;
+
+    std::optional<RoomId> next_room(RoomId current_room,
+                                    Direction direction) override;
+
+    [[nodiscard]] DirectionSet available_exits(RoomId room) const override {
+      return _world->exits(room);
+    }
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        const RoomName& room) const override;
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        RoomId room) const override {
+      return _world->room_message(room);
+    }
+
+    [[nodiscard]] std::string_view get_room_name(RoomId room) const override {
+      return _world->room_name(room);
+    }
+
+    [[nodiscard]] Room& get_room(const RoomName& room) override;
+
+    [[nodiscard]] Room& get_room(RoomId room) override;
+
+    /// Number of rooms this session has copied out of the image.
+    [[nodiscard]] std::size_t loaded_rooms() const {
+      return _loaded_rooms.size();
+    }
+
+   private:
+    /// Resolves a room name; throws std::out_of_range for unknown rooms.
+    [[nodiscard]] RoomId id_of(const RoomName& room) const;
+
+    SharedWorldImage _world;
+    std::unordered_map<RoomId, Room> _loaded_rooms{};
+  };
+
+}  // namespace adv_sk
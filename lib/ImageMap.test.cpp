@@ -0,0 +1,73 @@
+// ImageMap unit tests
+
+#include "ImageMap.hpp"
+
+#include "Direction.hpp"      // for Direction
+#include "Game.hpp"           // for Game
+#include "IInputHandler.hpp"  // for IInputHandler
+#include "Map.hpp"            // for create_map
+#include "Player.hpp"         // for Player
+#include "WorldImage.hpp"     // for WorldImage, compile_world_image
+#include "gtest/gtest.h"      // for TEST, EXPECT_EQ
+
+#include <memory>     // for make_unique
+#include <stdexcept>  // for out_of_range, invalid_argument
+
+namespace adv_sk::test {
+
+  namespace {
+    SharedWorldImage starter_image() {
+      return WorldImage::from_bytes(compile_world_image(*create_map()));
+    }
+  }  // namespace
+
+  TEST(ImageMap, answersQueriesFromImage) {
+    ImageMap map(starter_image());
+    const auto grand_hall = map.find_room("GrandHall");
+    ASSERT_TRUE(grand_hall.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    EXPECT_EQ(map.get_room_name(*grand_hall), "GrandHall");
+    EXPECT_EQ(map.next_room(*grand_hall, Direction::North),
+              map.find_room("Armoury"));
+    EXPECT_FALSE(map.next_room(*grand_hall, Direction::East).has_value());
+    EXPECT_EQ(map.available_exits(*grand_hall).size(), 1);
+    // NOLINTEND(bugprone-unchecked-optional-access)
+    EXPECT_EQ(map.next_room("Armoury", Direction::South), "GrandHall");
+    EXPECT_EQ(map.get_welcome_message("Armoury"),
+              "You are in the Armoury. Racks of dusty weapons line the walls.");
+    EXPECT_EQ(map.loaded_rooms(), 0);
+  }
+
+  TEST(ImageMap, loadsRoomsOnceAndKeepsChanges) {
+    const auto image = starter_image();
+    ImageMap first(image);
+    ImageMap second(image);
+
+    first.get_room("GrandHall").inventory().clear();
+    EXPECT_TRUE(first.get_room("GrandHall").inventory().empty());
+    EXPECT_EQ(first.loaded_rooms(), 1);
+    EXPECT_EQ(second.get_room("GrandHall").inventory().size(), 1);
+  }
+
+  TEST(ImageMap, unknownRoomThrows) {
+    ImageMap map(starter_image());
+    EXPECT_THROW(static_cast<void>(map.get_room("Attic")), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(map.get_welcome_message("Attic")),
+                 std::out_of_range);
+  }
+
+  TEST(ImageMap, requiresImage) {
+    EXPECT_THROW(ImageMap(nullptr), std::invalid_argument);
+  }
+
+  TEST(ImageMap, playsGame) {
+    Game game(std::make_unique<ImageMap>(starter_image()),
+              std::make_unique<Player>(), std::unique_ptr<IInputHandler>{});
+    game.investigate();
+    game.take_item("golden chalice");
+    EXPECT_EQ(game.get_current_message(), "You take the golden chalice\n");
+    game.move(Direction::North);
+    EXPECT_EQ(game.get_current_location(), "Armoury");
+  }
+
+}  // namespace adv_sk::test
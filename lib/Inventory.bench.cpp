@@ -0,0 +1,31 @@
+// Inventory benchmarks
+
+#include "Inventory.hpp"
+
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>  // for size_t
+#include <string>   // for string, to_string
+#include <utility>  // for move
+
+namespace adv_sk::bench {
+
+  namespace {
+    /// Takes an item out of a room of `range(0)` items and drops it back,
+    /// the way take_item and drop_item move items around.
+    void BM_InventoryTakeAndDrop(benchmark::State& state) {
+      const auto count = static_cast<std::size_t>(state.range(0));
+      Inventory room;
+      for (std::size_t item = 0; item < count; ++item) {
+        room.add(InventoryItem("item" + std::to_string(item)), true);
+      }
+      const std::string wanted = "item" + std::to_string(count / 2);
+      for (auto _ : state) {
+        auto item = room.remove(room.find_visible(wanted).value());
+        benchmark::DoNotOptimize(room.add(std::move(item)));
+      }
+    }
+    BENCHMARK(BM_InventoryTakeAndDrop)->RangeMultiplier(8)->Range(4, 4096);
+  }  // namespace
+
+}  // namespace adv_sk::bench
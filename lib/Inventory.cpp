@@ -0,0 +1,281 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "Inventory.hpp"
+
+#include <algorithm>  // for fill
+#include <bit>        // for countr_zero
+#include <stdexcept>  // for out_of_range
+#include <utility>    // for exchange, move
+
+namespace adv_sk {
+
+  std::vector<InventoryItem> make_items(
+      std::span<const ItemDefinition> definitions) {
+    std::vector<InventoryItem> items;
+    items.reserve(definitions.size());
+    for (const auto id : ItemCatalog::global().intern(definitions)) {
+      items.emplace_back(id);
+    }
+    return items;
+  }
+
+  Inventory::Inventory(allocator_type allocator)
+      : _items(allocator),
+        _visible(allocator),
+        _slot_of(allocator),
+        _slots(allocator) {
+  }
+
+  Inventory::Inventory(const Inventory& other)
+      : Inventory(other, allocator_type{}) {
+  }
+
+  Inventory::Inventory(const Inventory& other, allocator_type allocator)
+      : _items(other._items, allocator),
+        _visible(other._visible, allocator),
+        _slot_of(other._slot_of, allocator),
+        _slots(other._slots, allocator),
+        _free_slot(other._free_slot) {
+    copy_index(other._by_name);
+  }
+
+  Inventory::Inventory(Inventory&& other) noexcept
+      : _items(std::move(other._items)),
+        _visible(std::move(other._visible)),
+        _slot_of(std::move(other._slot_of)),
+        _slots(std::move(other._slots)),
+        _free_slot(std::exchange(other._free_slot, NO_SLOT)),
+        _by_name(std::exchange(other._by_name, nullptr)) {
+  }
+
+  Inventory::Inventory(Inventory&& other, allocator_type allocator)
+      : _items(std::move(other._items), allocator),
+        _visible(std::move(other._visible), allocator),
+        _slot_of(std::move(other._slot_of), allocator),
+        _slots(std::move(other._slots), allocator),
+        _free_slot(std::exchange(other._free_slot, NO_SLOT)) {
+    if (other.get_allocator() == allocator) {
+      _by_name = std::exchange(other._by_name, nullptr);
+    } else {
+      copy_index(other._by_name);
+    }
+  }
+
+  Inventory& Inventory::operator=(const Inventory& other) {
+    if (this != &other) {
+      _items = other._items;
+      _visible = other._visible;
+      _slot_of = other._slot_of;
+      _slots = other._slots;
+      _free_slot = other._free_slot;
+      copy_index(other._by_name);
+    }
+    return *this;
+  }
+
+  Inventory& Inventory::operator=(Inventory&& other) {
+    if (this != &other) {
+      // Like the vectors, the index moves only between equal allocators.
+      if (other.get_allocator() == get_allocator()) {
+        drop_index();
+        _by_name = std::exchange(other._by_name, nullptr);
+      } else {
+        copy_index(other._by_name);
+      }
+      _items = std::move(other._items);
+      _visible = std::move(other._visible);
+      _slot_of = std::move(other._slot_of);
+      _slots = std::move(other._slots);
+      _free_slot = std::exchange(other._free_slot, NO_SLOT);
+    }
+    return *this;
+  }
+
+  Inventory::~Inventory() {
+    drop_index();
+  }
+
+  Inventory::Inventory(std::initializer_list<InventoryItem> items)
+      : Inventory(std::vector<InventoryItem>(items)) {
+  }
+
+  Inventory::Inventory(std::vector<InventoryItem> items) {
+    _items.reserve(items.size());
+    for (const auto& item : items) {
+      add(item);
+    }
+  }
+
+  ItemHandle Inventory::add(InventoryItem item, bool visible) {
+    std::uint32_t slot = 0;
+    if (_free_slot != NO_SLOT) {
+      slot = _free_slot;
+      _free_slot = _slots[slot].position;
+    } else {
+      slot = static_cast<std::uint32_t>(_slots.size());
+      _slots.push_back(Slot{.position = 0, .generation = 0, .live = false});
+    }
+    const auto position = _items.size();
+    _slots[slot].position = static_cast<std::uint32_t>(position);
+    _slots[slot].live = true;
+    _items.push_back(item);
+    _slot_of.push_back(slot);
+    if (position % WORD_BITS == 0) {
+      _visible.push_back(0);
+    }
+    set_visible(position, visible);
+
+    // Once built, the index stays until the inventory is empty again.
+    if (_by_name != nullptr) {
+      index(position);
+    } else if (_items.size() > INDEXED_SIZE) {
+      _by_name = get_allocator().new_object<NameIndex>();
+      for (std::size_t indexed = 0; indexed < _items.size(); ++indexed) {
+        index(indexed);
+      }
+    }
+    return ItemHandle{slot, _slots[slot].generation};
+  }
+
+  std::optional<ItemHandle> Inventory::find(std::string_view name) const {
+    return find_named(name, [](std::size_t) { return true; });
+  }
+
+  std::optional<ItemHandle> Inventory::find_visible(
+      std::string_view name) const {
+    if (_by_name != nullptr) {
+      return find_named(
+          name, [this](std::size_t position) { return is_visible(position); });
+    }
+    for (std::size_t word = 0; word < _visible.size(); ++word) {
+      for (auto bits = _visible[word]; bits != 0; bits &= bits - 1) {
+        const auto position = (word * WORD_BITS) + std::countr_zero(bits);
+        if (_items[position].name() == name) {
+          return handle_at(position);
+        }
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool Inventory::contains(ItemHandle handle) const {
+    return handle.slot < _slots.size() && _slots[handle.slot].live &&
+           _slots[handle.slot].generation == handle.generation;
+  }
+
+  std::uint32_t Inventory::position_of(ItemHandle handle) const {
+    if (!contains(handle)) {
+      throw std::out_of_range("Item is no longer in this inventory");
+    }
+    return _slots[handle.slot].position;
+  }
+
+  const InventoryItem& Inventory::at(ItemHandle handle) const {
+    return _items[position_of(handle)];
+  }
+
+  InventoryItem& Inventory::at(ItemHandle handle) {
+    return _items[position_of(handle)];
+  }
+
+  InventoryItem Inventory::remove(ItemHandle handle) {
+    const auto position = position_of(handle);
+    const auto last = _items.size() - 1;
+    if (_by_name != nullptr) {
+      unindex(position);
+    }
+
+    const auto item = _items[position];
+    if (position != last) {
+      _items[position] = _items[last];
+      _slot_of[position] = _slot_of[last];
+      _slots[_slot_of[position]].position = position;
+      set_visible(position, is_visible(last));
+    }
+    set_visible(last, false);
+    _items.pop_back();
+    _slot_of.pop_back();
+    if (last % WORD_BITS == 0) {
+      _visible.pop_back();
+    }
+
+    auto& slot = _slots[handle.slot];
+    slot.live = false;
+    ++slot.generation;
+    slot.position = _free_slot;
+    _free_slot = handle.slot;
+    return item;
+  }
+
+  std::size_t Inventory::erase(const InventoryItem& item) {
+    std::size_t erased = 0;
+    while (const auto found = find_named(
+               item.name(),
+               [this, &item](std::size_t position) {
+                 return _items[position] == item;
+               })) {
+      remove(found.value());
+      ++erased;
+    }
+    return erased;
+  }
+
+  void Inventory::clear() {
+    *this = Inventory();
+  }
+
+  void Inventory::reveal(ItemHandle handle) {
+    set_visible(position_of(handle), true);
+  }
+
+  void Inventory::reveal_all() {
+    std::fill(_visible.begin(), _visible.end(), ~std::uint64_t{0});
+    if (const auto tail = _items.size() % WORD_BITS; tail != 0) {
+      _visible.back() = (std::uint64_t{1} << tail) - 1;
+    }
+  }
+
+  void Inventory::set_visible(std::size_t position, bool visible) {
+    const auto bit = std::uint64_t{1} << (position % WORD_BITS);
+    if (visible) {
+      _visible[position / WORD_BITS] |= bit;
+    } else {
+      _visible[position / WORD_BITS] &= ~bit;
+    }
+  }
+
+  void Inventory::index(std::size_t position) {
+    _by_name->emplace(name_hash(_items[position].name()), _slot_of[position]);
+  }
+
+  void Inventory::unindex(std::size_t position) {
+    const auto slot = _slot_of[position];
+    const auto [begin, end] =
+        _by_name->equal_range(name_hash(_items[position].name()));
+    for (auto entry = begin; entry != end; ++entry) {
+      if (entry->second == slot) {
+        _by_name->erase(entry);
+        break;
+      }
+    }
+    if (_by_name->empty()) {
+      drop_index();
+    }
+  }
+
+  void Inventory::copy_index(const NameIndex* index) {
+    drop_index();
+    if (index != nullptr) {
+      _by_name = get_allocator().new_object<NameIndex>(*index);
+    }
+  }
+
+  void Inventory::drop_index() {
+    if (_by_name != nullptr) {
+      get_allocator().delete_object(std::exchange(_by_name, nullptr));
+    }
+  }
+
+}  // namespace adv_sk
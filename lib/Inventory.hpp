@@ -1,15 +1,269 @@
 #pragma once
 
-#include <string>
+#include "ItemCatalog.hpp"  // for ItemCatalog, ItemDefinition, ItemId
+
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint32_t
+#include <functional>        // for hash
+#include <initializer_list>  // for initializer_list
+#include <memory_resource>   // for polymorphic_allocator
+#include <optional>          // for optional
+#include <span>              // for span
+#include <string>            // for string
+#include <string_view>       // for string_view
+#include <unordered_map>     // for pmr::unordered_multimap
+#include <vector>            // for vector, pmr::vector
 
 namespace adv_sk {
 
+  /// One copy of an item; which copies are visible is up to the Inventory.
   struct InventoryItem {
-    std::string name{};
-    std::string use_message{};
-    bool is_visible{false};
+    ItemId id{0};
+
+    InventoryItem() = default;
+
+    explicit InventoryItem(std::string_view name,
+                           std::string_view use_message = {})
+        : id(ItemCatalog::global().intern(name, use_message)) {
+    }
+
+    /// A copy of an item already in the global catalog.
+    explicit InventoryItem(ItemId item_id) : id(item_id) {
+    }
+
+    [[nodiscard]] const std::string& name() const {
+      return ItemCatalog::global().definition(id).name;
+    }
+
+    [[nodiscard]] const std::string& use_message() const {
+      return ItemCatalog::global().definition(id).use_message;
+    }
+
+    bool operator==(const InventoryItem& item) const = default;
+  };
+
+  /// Catalogued copies of `definitions`, interned as one batch.
+  std::vector<InventoryItem> make_items(
+      std::span<const ItemDefinition> definitions);
+
+  /// Refers to one item for as long as it stays in its inventory.
+  struct ItemHandle {
+    std::uint32_t slot{0};
+    std::uint32_t generation{0};
+
+    bool operator==(const ItemHandle& handle) const = default;
+  };
+
+  /**
+   * @brief Items of a room or player, with lookup by name.
+   *
+   * Items are listed in insertion order. remove() moves the last item into
+   * the gap, so removal is O(1) and the order after any sequence of changes
+   * is still the same on every run. Handles survive the moves; a handle to
+   * a removed item is detected, not reused. Inventories above
+   * INDEXED_SIZE items keep a hash index by name; smaller ones are
+   * scanned, which is faster at that size and allocates nothing. The
+   * index is allocated when it is first needed and held by one pointer,
+   * so a small inventory, as most rooms have, pays a word for it.
+   *
+   * Whether each item has been revealed is kept in a bitset alongside the
+   * items, one bit per position: revealing a room is a word fill and
+   * visible lookups scan only the set bits.
+   *
+   * Items may be changed in place as long as their names stay the same,
+   * since the index is keyed on them.
+   *
+   * All storage comes from the inventory's memory resource. Plain copies
+   * use the default resource; copies made with an allocator, as containers
+   * of inventories make them, use that allocator's.
+   */
+  class Inventory {
+   public:
+    static constexpr std::size_t INDEXED_SIZE = 16;
+
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    Inventory() = default;
+    explicit Inventory(allocator_type allocator);
+    Inventory(const Inventory& other, allocator_type allocator);
+    Inventory(Inventory&& other, allocator_type allocator);
+    Inventory(const Inventory& other);
+    Inventory(Inventory&& other) noexcept;
+    Inventory& operator=(const Inventory& other);
+    Inventory& operator=(Inventory&& other);
+    ~Inventory();
+
+    /// Every item starts hidden.
+    Inventory(std::initializer_list<InventoryItem> items);
+    explicit Inventory(std::vector<InventoryItem> items);
+
+    ItemHandle add(InventoryItem item, bool visible = false);
+
+    /// The first listed item named `name`.
+    [[nodiscard]] std::optional<ItemHandle> find(std::string_view name) const;
+
+    /// The first listed item named `name` that has been revealed.
+    [[nodiscard]] std::optional<ItemHandle> find_visible(
+        std::string_view name) const;
+
+    /// The first listed item named `name` whose position `accept` takes.
+    template <typename Accept>
+    [[nodiscard]] std::optional<ItemHandle> find_named(
+        std::string_view name, const Accept& accept) const;
+
+    [[nodiscard]] bool contains(ItemHandle handle) const;
+
+    /// Throws std::out_of_range for a handle to a removed item.
+    [[nodiscard]] const InventoryItem& at(ItemHandle handle) const;
+    [[nodiscard]] InventoryItem& at(ItemHandle handle);
+
+    /// Where the item is listed; throws std::out_of_range like at().
+    [[nodiscard]] std::size_t position(ItemHandle handle) const {
+      return position_of(handle);
+    }
+
+    /// Takes the item out; throws std::out_of_range like at().
+    InventoryItem remove(ItemHandle handle);
+
+    /// Removes every item equal to `item`; returns how many there were.
+    std::size_t erase(const InventoryItem& item);
+
+    void clear();
+
+    [[nodiscard]] bool is_visible(std::size_t position) const {
+      const auto bit = std::uint64_t{1} << (position % WORD_BITS);
+      return (_visible[position / WORD_BITS] & bit) != 0;
+    }
 
-    auto operator<=>(const InventoryItem& item) const = default;
+    void reveal(ItemHandle handle);
+
+    void reveal_all();
+
+    /// One bit per position, set where the item is visible; bits past
+    /// size() are always clear.
+    [[nodiscard]] std::span<const std::uint64_t> visibility() const {
+      return _visible;
+    }
+
+    [[nodiscard]] std::size_t size() const {
+      return _items.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+      return _items.empty();
+    }
+
+    [[nodiscard]] std::span<const InventoryItem> items() const {
+      return _items;
+    }
+
+    [[nodiscard]] const InventoryItem& operator[](std::size_t index) const {
+      return _items[index];
+    }
+
+    [[nodiscard]] InventoryItem& operator[](std::size_t index) {
+      return _items[index];
+    }
+
+    [[nodiscard]] InventoryItem& front() {
+      return _items.front();
+    }
+
+    [[nodiscard]] auto begin() const {
+      return _items.begin();
+    }
+
+    [[nodiscard]] auto end() const {
+      return _items.end();
+    }
+
+    [[nodiscard]] auto begin() {
+      return _items.begin();
+    }
+
+    [[nodiscard]] auto end() {
+      return _items.end();
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const {
+      return _items.get_allocator();
+    }
+
+    bool operator==(const Inventory& other) const {
+      return _items == other._items && _visible == other._visible;
+    }
+
+   private:
+    static constexpr std::uint32_t NO_SLOT = UINT32_MAX;
+    static constexpr std::size_t WORD_BITS = 64;
+
+    using NameIndex = std::pmr::unordered_multimap<std::size_t, std::uint32_t>;
+
+    struct Slot {
+      /// Position in _items, or the next free slot once the item is gone.
+      std::uint32_t position;
+      std::uint32_t generation;
+      bool live;
+    };
+
+    [[nodiscard]] static std::size_t name_hash(std::string_view name) {
+      return std::hash<std::string_view>{}(name);
+    }
+
+    [[nodiscard]] std::uint32_t position_of(ItemHandle handle) const;
+
+    [[nodiscard]] ItemHandle handle_at(std::size_t position) const {
+      const auto slot = _slot_of[position];
+      return ItemHandle{slot, _slots[slot].generation};
+    }
+
+    void set_visible(std::size_t position, bool visible);
+
+    void index(std::size_t position);
+
+    void unindex(std::size_t position);
+
+    /// Replaces the index with a copy of `index`, or none for nullptr.
+    void copy_index(const NameIndex* index);
+
+    void drop_index();
+
+    std::pmr::vector<InventoryItem> _items{};
+    std::pmr::vector<std::uint64_t> _visible{};
+    /// Slot of each item, parallel to _items.
+    std::pmr::vector<std::uint32_t> _slot_of{};
+    std::pmr::vector<Slot> _slots{};
+    std::uint32_t _free_slot{NO_SLOT};
+    /// Name hash to slot; only built above INDEXED_SIZE items.
+    NameIndex* _by_name{nullptr};
   };
 
+  template <typename Accept>
+  std::optional<ItemHandle> Inventory::find_named(std::string_view name,
+                                                  const Accept& accept) const {
+    if (_by_name == nullptr) {
+      for (std::size_t position = 0; position < _items.size(); ++position) {
+        if (_items[position].name() == name && accept(position)) {
+          return handle_at(position);
+        }
+      }
+      return std::nullopt;
+    }
+    // Items sharing a name sit in one bucket in no particular order, so the
+    // first listed one is picked explicitly.
+    std::optional<std::uint32_t> first;
+    const auto [begin, end] = _by_name->equal_range(name_hash(name));
+    for (auto entry = begin; entry != end; ++entry) {
+      const auto position = _slots[entry->second].position;
+      if ((!first.has_value() || position < first.value()) &&
+          _items[position].name() == name && accept(position)) {
+        first = position;
+      }
+    }
+    if (!first.has_value()) {
+      return std::nullopt;
+    }
+    return handle_at(first.value());
+  }
+
 }  // namespace adv_sk
@@ -0,0 +1,197 @@
+// Inventory unit tests
+
+#include "Inventory.hpp"
+
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <cstddef>          // for size_t
+#include <cstdint>          // for uint64_t
+#include <memory_resource>  // for monotonic_buffer_resource
+#include <stdexcept>        // for out_of_range
+#include <string>           // for string, to_string
+#include <utility>          // for move
+#include <vector>           // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    std::vector<std::string> names(const Inventory& inventory) {
+      std::vector<std::string> result;
+      for (const auto& item : inventory) {
+        result.push_back(item.name());
+      }
+      return result;
+    }
+
+    /// Large enough to be indexed by name.
+    Inventory numbered(std::size_t count) {
+      Inventory inventory;
+      for (std::size_t item = 0; item < count; ++item) {
+        inventory.add(InventoryItem("item" + std::to_string(item)), true);
+      }
+      return inventory;
+    }
+  }  // namespace
+
+  TEST(Inventory, listsItemsInInsertionOrder) {
+    const Inventory inventory{InventoryItem("sword"), InventoryItem("shield")};
+    EXPECT_EQ(names(inventory), (std::vector<std::string>{"sword", "shield"}));
+  }
+
+  TEST(Inventory, findsItemByName) {
+    const Inventory inventory{InventoryItem("sword"), InventoryItem("shield")};
+    const auto found = inventory.find("shield");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(inventory.at(found.value()).name(), "shield");
+    EXPECT_FALSE(inventory.find("lamp").has_value());
+  }
+
+  TEST(Inventory, findVisibleSkipsHiddenItems) {
+    Inventory inventory{InventoryItem("key", "hidden")};
+    inventory.add(InventoryItem("key", "shown"), true);
+    const auto found = inventory.find_visible("key");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(inventory.at(found.value()).use_message(), "shown");
+  }
+
+  TEST(Inventory, indexedFindVisibleSkipsHiddenItems) {
+    auto inventory = numbered(Inventory::INDEXED_SIZE * 2);
+    inventory.add(InventoryItem("item3", "hidden"));
+    const auto hidden = inventory.add(InventoryItem("ghost"));
+    EXPECT_FALSE(inventory.find_visible("ghost").has_value());
+    inventory.reveal(hidden);
+    EXPECT_TRUE(inventory.find_visible("ghost").has_value());
+    const auto found = inventory.find_visible("item3");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_TRUE(inventory.at(found.value()).use_message().empty());
+  }
+
+  TEST(Inventory, revealAllSetsOneBitPerItem) {
+    Inventory inventory;
+    for (std::size_t item = 0; item < 70; ++item) {
+      inventory.add(InventoryItem("item" + std::to_string(item)));
+    }
+    inventory.reveal_all();
+    ASSERT_EQ(inventory.visibility().size(), 2);
+    EXPECT_EQ(inventory.visibility()[0], ~std::uint64_t{0});
+    EXPECT_EQ(inventory.visibility()[1], 0b111111U);
+  }
+
+  TEST(Inventory, visibilityMovesWithItems) {
+    Inventory inventory{InventoryItem("a"), InventoryItem("b")};
+    const auto last = inventory.add(InventoryItem("c"), true);
+    inventory.remove(inventory.find("a").value());
+    EXPECT_EQ(inventory.at(last).name(), "c");
+    EXPECT_TRUE(inventory.is_visible(0));
+    EXPECT_FALSE(inventory.is_visible(1));
+    EXPECT_EQ(inventory.visibility()[0], 0b1U);
+    EXPECT_TRUE(inventory.find_visible("c").has_value());
+    EXPECT_FALSE(inventory.find_visible("b").has_value());
+  }
+
+  TEST(Inventory, removeMovesLastItemIntoGap) {
+    Inventory inventory{InventoryItem("a"), InventoryItem("b"),
+                        InventoryItem("c")};
+    const auto removed = inventory.remove(inventory.find("a").value());
+    EXPECT_EQ(removed.name(), "a");
+    EXPECT_EQ(names(inventory), (std::vector<std::string>{"c", "b"}));
+  }
+
+  TEST(Inventory, handlesSurviveRemovalOfOtherItems) {
+    Inventory inventory{InventoryItem("a"), InventoryItem("b")};
+    const auto last = inventory.add(InventoryItem("c"));
+    inventory.remove(inventory.find("a").value());
+    ASSERT_TRUE(inventory.contains(last));
+    EXPECT_EQ(inventory.at(last).name(), "c");
+  }
+
+  TEST(Inventory, staleHandleThrows) {
+    Inventory inventory;
+    const auto handle = inventory.add(InventoryItem("lamp"));
+    inventory.remove(handle);
+    // The freed slot is reused, but the old handle still does not match.
+    inventory.add(InventoryItem("rope"));
+    EXPECT_FALSE(inventory.contains(handle));
+    EXPECT_THROW((void)inventory.at(handle), std::out_of_range);
+    EXPECT_THROW(inventory.remove(handle), std::out_of_range);
+  }
+
+  TEST(Inventory, eraseRemovesEveryEqualItem) {
+    Inventory inventory{InventoryItem("coin"), InventoryItem("gem"),
+                        InventoryItem("coin")};
+    EXPECT_EQ(inventory.erase(InventoryItem("coin")), 2);
+    EXPECT_EQ(names(inventory), (std::vector<std::string>{"gem"}));
+    EXPECT_EQ(inventory.erase(InventoryItem("coin")), 0);
+  }
+
+  TEST(Inventory, indexedLookupFindsEveryItem) {
+    auto inventory = numbered(Inventory::INDEXED_SIZE * 4);
+    for (std::size_t item = 0; item < inventory.size(); ++item) {
+      const auto found = inventory.find("item" + std::to_string(item));
+      ASSERT_TRUE(found.has_value());
+      EXPECT_EQ(inventory.at(found.value()).name(),
+                "item" + std::to_string(item));
+    }
+    EXPECT_FALSE(inventory.find("item9999").has_value());
+  }
+
+  TEST(Inventory, indexedLookupPicksFirstListedDuplicate) {
+    auto inventory = numbered(Inventory::INDEXED_SIZE * 2);
+    inventory.add(InventoryItem("item3", "second"));
+    const auto found = inventory.find("item3");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_TRUE(inventory.at(found.value()).use_message().empty());
+  }
+
+  TEST(Inventory, indexFollowsRemovalsAndAdditions) {
+    auto inventory = numbered(Inventory::INDEXED_SIZE + 1);
+    for (std::size_t item = 0; item < Inventory::INDEXED_SIZE; ++item) {
+      inventory.remove(inventory.find("item" + std::to_string(item)).value());
+    }
+    inventory.add(InventoryItem("late"));
+    EXPECT_TRUE(inventory.find("late").has_value());
+    EXPECT_TRUE(inventory.find("item16").has_value());
+    EXPECT_FALSE(inventory.find("item0").has_value());
+    EXPECT_EQ(inventory.size(), 2);
+  }
+
+  TEST(Inventory, orderAfterChangesIsDeterministic) {
+    const auto play = [] {
+      auto inventory = numbered(Inventory::INDEXED_SIZE * 2);
+      for (const auto* name : {"item5", "item0", "item20", "item31"}) {
+        inventory.remove(inventory.find(name).value());
+      }
+      inventory.add(InventoryItem("extra"));
+      return names(inventory);
+    };
+    EXPECT_EQ(play(), play());
+  }
+
+  TEST(Inventory, copiesAndMovesKeepTheirOwnIndex) {
+    auto original = numbered(Inventory::INDEXED_SIZE * 2);
+    auto copy = original;
+    std::pmr::monotonic_buffer_resource arena;
+    Inventory in_arena(original, &arena);
+    Inventory assigned;
+    assigned = copy;
+
+    original.remove(original.find("item3").value());
+    EXPECT_FALSE(original.find("item3").has_value());
+    for (const auto* inventory : {&copy, &in_arena, &assigned}) {
+      EXPECT_TRUE(inventory->find("item3").has_value());
+    }
+
+    Inventory moved(std::move(in_arena), Inventory::allocator_type{});
+    EXPECT_TRUE(moved.find("item31").has_value());
+    assigned = std::move(moved);
+    EXPECT_TRUE(assigned.find("item31").has_value());
+  }
+
+  TEST(Inventory, clearEmptiesInventory) {
+    auto inventory = numbered(Inventory::INDEXED_SIZE * 2);
+    inventory.clear();
+    EXPECT_TRUE(inventory.empty());
+    EXPECT_FALSE(inventory.find("item1").has_value());
+  }
+
+}  // namespace adv_sk::test
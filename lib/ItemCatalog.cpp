@@ -0,0 +1,95 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "ItemCatalog.hpp"
+
+#include <algorithm>  // for max
+#include <bit>        // for bit_ceil
+#include <stdexcept>  // for length_error
+#include <utility>    // for swap
+
+namespace adv_sk {
+
+  ItemCatalog::ItemCatalog() {
+    intern({}, {});
+  }
+
+  ItemCatalog& ItemCatalog::global() {
+    static ItemCatalog catalog;
+    return catalog;
+  }
+
+  ItemId ItemCatalog::intern(std::string_view name,
+                             std::string_view use_message) {
+    const std::lock_guard lock(_mutex);
+    return intern_locked(name, use_message);
+  }
+
+  std::vector<ItemId> ItemCatalog::intern(
+      std::span<const ItemDefinition> definitions) {
+    std::vector<ItemId> ids;
+    ids.reserve(definitions.size());
+    const std::lock_guard lock(_mutex);
+    reserve_slots(definitions.size());
+    for (const auto& definition : definitions) {
+      ids.push_back(intern_locked(definition.name, definition.use_message));
+    }
+    return ids;
+  }
+
+  ItemId ItemCatalog::intern_locked(std::string_view name,
+                                    std::string_view use_message) {
+    reserve_slots(1);
+    const auto hash = hash_of(name, use_message);
+    const auto mask = _slots.size() - 1;
+    auto slot = hash & mask;
+    for (; _slots[slot].id != NO_ITEM; slot = (slot + 1) & mask) {
+      if (_slots[slot].hash == hash) {
+        const auto [chunk, offset] = locate(_slots[slot].id);
+        const auto& stored = _storage[chunk][offset];
+        if (stored.name == name && stored.use_message == use_message) {
+          return _slots[slot].id;
+        }
+      }
+    }
+
+    const auto size = _size.load(std::memory_order_relaxed);
+    if (size >= NO_ITEM) {
+      throw std::length_error("Item catalog is full");
+    }
+    const auto id = static_cast<ItemId>(size);
+    const auto [chunk, offset] = locate(id);
+    if (offset == 0) {
+      _storage[chunk] =
+          std::make_unique<ItemDefinition[]>(FIRST_CHUNK_SIZE << chunk);
+      _chunks[chunk].store(_storage[chunk].get(), std::memory_order_release);
+    }
+    auto& definition = _storage[chunk][offset];
+    definition.name = name;
+    definition.use_message = use_message;
+    _slots[slot] = Slot{.hash = hash, .id = id};
+    _size.store(size + 1, std::memory_order_release);
+    return id;
+  }
+
+  void ItemCatalog::reserve_slots(std::size_t count) {
+    const auto needed = (_size.load(std::memory_order_relaxed) + count) * 2;
+    if (needed <= _slots.size()) {
+      return;
+    }
+    std::vector<Slot> old_slots(std::bit_ceil(std::max(needed, MIN_SLOTS)));
+    std::swap(_slots, old_slots);
+    const auto mask = _slots.size() - 1;
+    for (const auto& entry : old_slots) {
+      if (entry.id != NO_ITEM) {
+        auto slot = entry.hash & mask;
+        while (_slots[slot].id != NO_ITEM) {
+          slot = (slot + 1) & mask;
+        }
+        _slots[slot] = entry;
+      }
+    }
+  }
+
+}  // namespace adv_sk
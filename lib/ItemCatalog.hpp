@@ -0,0 +1,114 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include <array>          // for array
+#include <atomic>         // for atomic
+#include <bit>            // for bit_width
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t, uint64_t
+#include <functional>     // for hash
+#include <limits>         // for numeric_limits
+#include <memory>         // for unique_ptr
+#include <mutex>          // for mutex
+#include <span>           // for span
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <utility>        // for pair
+#include <vector>         // for vector
+
+namespace adv_sk {
+
+  using ItemId = std::uint32_t;
+
+  /// What every copy of an item shares.
+  struct ItemDefinition {
+    std::string name{};
+    std::string use_message{};
+  };
+
+  /**
+   * @brief Item definitions, each stored once however many copies exist.
+   *
+   * intern() hands out the same id for the same name and use message. Ids
+   * are never reused and definitions never move, so definition() takes no
+   * lock and its references stay valid for the life of the catalog. Id 0
+   * is the item without a name or use message.
+   *
+   * Ids are found through an open-addressing table of ids and key hashes,
+   * so a lookup reads a stored definition only when the hashes match.
+   * Loaders intern a whole batch of definitions under one lock.
+   */
+  class ItemCatalog {
+   public:
+    ItemCatalog();
+    ItemCatalog(const ItemCatalog&) = delete;
+    ItemCatalog& operator=(const ItemCatalog&) = delete;
+
+    /// The catalog shared by every InventoryItem.
+    static ItemCatalog& global();
+
+    /// Safe to call from several threads at once.
+    ItemId intern(std::string_view name, std::string_view use_message);
+
+    /// intern() for a whole batch under one lock, as a world loader needs.
+    std::vector<ItemId> intern(std::span<const ItemDefinition> definitions);
+
+    /// `id` must come from intern().
+    [[nodiscard]] const ItemDefinition& definition(ItemId id) const {
+      const auto [chunk, offset] = locate(id);
+      return _chunks[chunk].load(std::memory_order_acquire)[offset];
+    }
+
+    [[nodiscard]] std::size_t size() const {
+      return _size.load(std::memory_order_acquire);
+    }
+
+   private:
+    /// Chunk k holds FIRST_CHUNK_SIZE << k definitions.
+    static constexpr std::size_t FIRST_CHUNK_BITS = 10;
+    static constexpr std::size_t FIRST_CHUNK_SIZE = std::size_t{1}
+                                                    << FIRST_CHUNK_BITS;
+    static constexpr std::size_t CHUNK_COUNT = 32 - FIRST_CHUNK_BITS + 1;
+
+    static constexpr ItemId NO_ITEM = std::numeric_limits<ItemId>::max();
+    static constexpr std::size_t MIN_SLOTS = 1024;
+
+    /// An id with its key's hash, so probing and growing compare no text.
+    struct Slot {
+      std::size_t hash{0};
+      ItemId id{NO_ITEM};
+    };
+
+    static std::size_t hash_of(std::string_view name,
+                               std::string_view use_message) {
+      const auto hash = std::hash<std::string_view>{}(name);
+      return hash ^ (std::hash<std::string_view>{}(use_message) + 0x9e3779b9 +
+                     (hash << 6) + (hash >> 2));
+    }
+
+    static std::pair<std::size_t, std::size_t> locate(ItemId id) {
+      const auto biased = std::uint64_t{id} + FIRST_CHUNK_SIZE;
+      const auto chunk =
+          static_cast<std::size_t>(std::bit_width(biased)) - 1 -
+          FIRST_CHUNK_BITS;
+      return {chunk, biased - (FIRST_CHUNK_SIZE << chunk)};
+    }
+
+    /// intern() once the lock is held.
+    ItemId intern_locked(std::string_view name, std::string_view use_message);
+
+    /// Makes room for `count` more ids at a load factor of at most one half.
+    void reserve_slots(std::size_t count);
+
+    std::array<std::atomic<const ItemDefinition*>, CHUNK_COUNT> _chunks{};
+    std::array<std::unique_ptr<ItemDefinition[]>, CHUNK_COUNT> _storage{};
+    std::atomic<std::size_t> _size{0};
+    /// Guards interning and the open-addressing table of ids below.
+    std::mutex _mutex{};
+    std::vector<Slot> _slots{};
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,90 @@
+// ItemCatalog unit tests
+
+#include "ItemCatalog.hpp"
+
+#include "Inventory.hpp"  // for InventoryItem
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <cstddef>  // for size_t
+#include <string>   // for string, to_string
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+namespace adv_sk::test {
+
+  TEST(ItemCatalog, startsWithEmptyItem) {
+    const ItemCatalog catalog;
+    EXPECT_EQ(catalog.size(), 1);
+    EXPECT_TRUE(catalog.definition(0).name.empty());
+    EXPECT_TRUE(catalog.definition(0).use_message.empty());
+  }
+
+  TEST(ItemCatalog, internsEqualItemsOnce) {
+    ItemCatalog catalog;
+    const auto sword = catalog.intern("sword", "Swish.");
+    EXPECT_EQ(catalog.intern("sword", "Swish."), sword);
+    EXPECT_NE(catalog.intern("sword", "Clang."), sword);
+    EXPECT_NE(catalog.intern("shield", "Swish."), sword);
+    EXPECT_EQ(catalog.size(), 4);
+    EXPECT_EQ(catalog.definition(sword).name, "sword");
+    EXPECT_EQ(catalog.definition(sword).use_message, "Swish.");
+  }
+
+  TEST(ItemCatalog, definitionsStayPutAsCatalogGrows) {
+    ItemCatalog catalog;
+    const auto& first = catalog.definition(catalog.intern("first", ""));
+    for (std::size_t item = 0; item < 10'000; ++item) {
+      catalog.intern("item" + std::to_string(item), "");
+    }
+    EXPECT_EQ(first.name, "first");
+    EXPECT_EQ(catalog.definition(catalog.intern("item9999", "")).name,
+              "item9999");
+  }
+
+  TEST(ItemCatalog, batchInternMatchesSingleIntern) {
+    ItemCatalog catalog;
+    const auto sword = catalog.intern("sword", "Swish.");
+    const std::vector<ItemDefinition> definitions{
+        {.name = "shield"},
+        {.name = "sword", .use_message = "Swish."},
+        {.name = "shield"},
+    };
+    const auto ids = catalog.intern(definitions);
+    EXPECT_EQ(ids, (std::vector<ItemId>{ids[0], sword, ids[0]}));
+    EXPECT_EQ(catalog.intern("shield", ""), ids[0]);
+    EXPECT_EQ(catalog.size(), 3);
+  }
+
+  TEST(ItemCatalog, concurrentInterningAgreesOnIds) {
+    constexpr std::size_t THREADS = 4;
+    constexpr std::size_t ITEMS = 2'000;
+    ItemCatalog catalog;
+    std::vector<std::vector<ItemId>> ids(THREADS);
+    std::vector<std::thread> threads;
+    for (std::size_t thread = 0; thread < THREADS; ++thread) {
+      threads.emplace_back([&catalog, &ids, thread] {
+        for (std::size_t item = 0; item < ITEMS; ++item) {
+          ids[thread].push_back(
+              catalog.intern("item" + std::to_string(item), ""));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    EXPECT_EQ(catalog.size(), ITEMS + 1);
+    for (std::size_t thread = 1; thread < THREADS; ++thread) {
+      EXPECT_EQ(ids[thread], ids[0]);
+    }
+  }
+
+  TEST(ItemCatalog, inventoryItemsShareDefinitions) {
+    const InventoryItem first("lamp", "It glows.");
+    const InventoryItem second("lamp", "It glows.");
+    EXPECT_EQ(first.id, second.id);
+    EXPECT_EQ(&first.name(), &second.name());
+    EXPECT_EQ(second.use_message(), "It glows.");
+    EXPECT_EQ(sizeof(InventoryItem), sizeof(ItemId));
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,80 @@
+// Map benchmarks
+
+#include "Map.hpp"
+
+#include "BenchmarkSupport.hpp"   // for make_corridor_world, MIN_ROOMS
+#include "Direction.hpp"          // for Direction
+#include "Types.hpp"              // for RoomId, RoomName
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
+namespace adv_sk::bench {
+
+  namespace {
+    void BM_MapConstruction(benchmark::State& state) {
+      const auto world =
+          make_corridor_world(static_cast<std::size_t>(state.range(0)), 1);
+      for (auto _ : state) {
+        const Map map(world.rooms, world.connections);
+        benchmark::DoNotOptimize(map.size());
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_MapConstruction)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS)
+        ->Unit(benchmark::kMillisecond);
+
+    void BM_MapNextRoomById(benchmark::State& state) {
+      const auto map =
+          make_corridor_map(static_cast<std::size_t>(state.range(0)), 1);
+      RoomId room = 0;
+      for (auto _ : state) {
+        const auto next = map->next_room(room, Direction::North);
+        room = next.value_or(0);
+        benchmark::DoNotOptimize(room);
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_MapNextRoomById)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS);
+
+    void BM_MapNextRoomByName(benchmark::State& state) {
+      const auto room_count = static_cast<std::size_t>(state.range(0));
+      const auto map = make_corridor_map(room_count, 1);
+      std::vector<RoomName> names;
+      names.reserve(room_count);
+      for (std::size_t index = 0; index < room_count; ++index) {
+        names.push_back(corridor_room_name(index));
+      }
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            map->next_room(names[index], Direction::North));
+        index = index + 1 == room_count ? 0 : index + 1;
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_MapNextRoomByName)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS);
+
+    void BM_MapAvailableExits(benchmark::State& state) {
+      const auto room_count = static_cast<RoomId>(state.range(0));
+      const auto map = make_corridor_map(room_count, 1);
+      RoomId room = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(map->available_exits(room));
+        room = room + 1 == room_count ? 0 : room + 1;
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_MapAvailableExits)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS);
+  }  // namespace
+
+}  // namespace adv_sk::bench
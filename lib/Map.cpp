@@ -9,38 +9,79 @@
 #include "Room.hpp"
 
 #include <optional>
+#include <stdexcept>  // for out_of_range
 #include <string>
+#include <string_view>
 #include <unordered_map>
-#include <utility>  // for pair
+#include <utility>  // for pair, move
 
 namespace adv_sk {
 
   Map::Map(const std::vector<Room>& rooms,
-           const std::unordered_map<RoomName, RoomConnections>& connections) {
+           const std::unordered_map<RoomName, NamedConnections>& connections) {
+    _rooms.reserve(rooms.size());
+    _room_ids = RoomNameIndex(rooms.size());
     for (const auto& room : rooms) {
-      _rooms.emplace(room.get_name(), room);
+      const auto room_id = static_cast<RoomId>(_rooms.size());
+      if (_room_ids.insert(room.get_name(), room_id, _rooms)) {
+        _rooms.push_back(room);
+      }
     }
+
     for (const auto& [room_name, connection] : connections) {
-      for (const auto& [direction, room_name_to] : connection.connections) {
-        _rooms.find(room_name)->second.add_connection(direction, room_name_to);
-        _rooms.find(room_name_to)
-            ->second.add_connection(opposite_direction(direction), room_name);
+      const auto room_from = id_of(room_name);
+      for (const auto& [direction, room_name_to] : connection) {
+        const auto room_to = id_of(room_name_to);
+        _rooms[room_from].add_connection(direction, room_to);
+        _rooms[room_to].add_connection(opposite_direction(direction),
+                                       room_from);
       }
     }
   }
 
-  std::optional<RoomName> Map::next_room(const RoomName& current_room,
-                                         Direction direction) {
-    auto room = _rooms.find(current_room)->second;
+  Map::Map(std::vector<Room> rooms)
+      : _rooms(std::move(rooms)), _room_ids(_rooms.size()) {
+    for (RoomId room_id = 0; room_id < _rooms.size(); ++room_id) {
+      _room_ids.insert(_rooms[room_id].get_name(), room_id, _rooms);
+    }
+  }
+
+  std::optional<RoomId> Map::find_room(const RoomName& room) const {
+    return _room_ids.find(room, _rooms);
+  }
 
-    if (!room.connections().connections.contains(direction)) {
+  RoomId Map::id_of(const RoomName& room) const {
+    const auto room_id = _room_ids.find(room, _rooms);
+    if (!room_id.has_value()) {
+      throw std::out_of_range("Unknown room: " + room);
+    }
+    return room_id.value();
+  }
+
+  std::optional<std::string_view> Map::next_room(const RoomName& current_room,
+                                                 Direction direction) {
+    const auto next = next_room(id_of(current_room), direction);
+    if (!next.has_value()) {
       return std::nullopt;
     }
-    return room.connections().connections.find(direction)->second;
+    return _rooms[next.value()].get_name();
+  }
+
+  std::optional<RoomId> Map::next_room(RoomId current_room,
+                                       Direction direction) {
+    const auto next = _rooms[current_room].connections().target(direction);
+    if (next == INVALID_ROOM_ID) {
+      return std::nullopt;
+    }
+    return next;
+  }
+
+  std::string_view Map::get_welcome_message(const RoomName& room) const {
+    return get_welcome_message(id_of(room));
   }
 
-  std::string Map::get_welcome_message(const RoomName& room) const {
-    return _rooms.find(room)->second.get_message();
+  std::string_view Map::get_welcome_message(RoomId room) const {
+    return _rooms[room].get_message();
   }
 
   std::unique_ptr<adv_sk::Map> create_map() {
@@ -57,12 +98,12 @@ namespace adv_sk {
         "Armoury",
         "You are in the Armoury. Racks of dusty weapons line the walls.",
         {sword});
-    RoomConnections grand_hall_connection;
-    grand_hall_connection.add(Direction::North, "Armoury");
+    const NamedConnections grand_hall_connection{
+        {Direction::North, "Armoury"}};
 
     auto map =
         std::make_unique<Map>(std::vector<Room>{grand_hall, armory},
-                              std::unordered_map<RoomName, RoomConnections>{
+                              std::unordered_map<RoomName, NamedConnections>{
                                   {"GrandHall", grand_hall_connection}});
 
     return map;
@@ -4,34 +4,95 @@
 
 #pragma once
 
-#include "IMap.hpp"   // for IMap
-#include "Room.hpp"   // for Room, RoomConnections
-#include "Types.hpp"  // for RoomName
+#include "IMap.hpp"           // for IMap
+#include "Room.hpp"           // for Room, NamedConnections
+#include "RoomNameIndex.hpp"  // for RoomNameIndex
+#include "Types.hpp"          // for RoomName, RoomId
 
+#include <cstddef>        // for size_t
 #include <memory>         // for unique_ptr
-#include <string>         // for string
+#include <optional>       // for optional
+#include <span>           // for span
+#include <string_view>    // for string_view
 #include <unordered_map>  // for unordered_map
 #include <vector>         // for vector
 
 namespace adv_sk {
 
-  class Map : public IMap {
+  /**
+   * @brief World store with rooms kept in a contiguous vector.
+   *
+   * Room names are interned into dense RoomId values once, at construction,
+   * and exits are stored as RoomId tables in each room. The RoomId overloads
+   * index the room vector directly and do no hashing; the RoomName overloads
+   * resolve the name first. Names and messages are returned as views into the
+   * stored rooms, so lookups never copy a Room.
+   */
+  class Map final : public IMap {
    public:
     Map(const std::vector<Room>& rooms,
-        const std::unordered_map<RoomName, RoomConnections>& connections);
+        const std::unordered_map<RoomName, NamedConnections>& connections);
 
-    std::optional<RoomName> next_room(const RoomName& current_room,
-                                      Direction direction) override;
+    /**
+     * @brief Adopts rooms that are already linked by RoomId.
+     *
+     * Room i gets RoomId i, and its connections must refer to positions in
+     * `rooms` and be reciprocal. Only the names are interned, which makes
+     * this the fast path for generated and loaded worlds.
+     */
+    explicit Map(std::vector<Room> rooms);
 
-    [[nodiscard]] std::string get_welcome_message(
+    [[nodiscard]] std::optional<RoomId> find_room(
         const RoomName& room) const override;
 
+    std::optional<std::string_view> next_room(const RoomName& current_room,
+                                              Direction direction) override;
+
+    std::optional<RoomId> next_room(RoomId current_room,
+                                    Direction direction) override;
+
+    [[nodiscard]] DirectionSet available_exits(RoomId room) const override {
+      return _rooms[room].connections().directions();
+    }
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        const RoomName& room) const override;
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        RoomId room) const override;
+
+    [[nodiscard]] std::string_view get_room_name(RoomId room) const override {
+      return _rooms[room].get_name();
+    }
+
     [[nodiscard]] Room& get_room(const RoomName& room) override {
-      return _rooms.at(room);
+      return _rooms[id_of(room)];
+    }
+
+    [[nodiscard]] Room& get_room(RoomId room) override {
+      return _rooms[room];
+    }
+
+    /// Read-only access for sessions sharing this world.
+    [[nodiscard]] const Room& get_room(RoomId room) const {
+      return _rooms[room];
+    }
+
+    [[nodiscard]] std::size_t size() const {
+      return _rooms.size();
+    }
+
+    /// Room i has RoomId i.
+    [[nodiscard]] std::span<const Room> rooms() const {
+      return _rooms;
     }
 
    private:
-    std::unordered_map<RoomName, Room> _rooms{};
+    /// Resolves a room name; throws std::out_of_range for unknown rooms.
+    [[nodiscard]] RoomId id_of(const RoomName& room) const;
+
+    std::vector<Room> _rooms{};
+    RoomNameIndex _room_ids{};
   };
 
   std::unique_ptr<Map> create_map();
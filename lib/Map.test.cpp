@@ -2,11 +2,12 @@
 
 #include "Map.hpp"
 
-#include "Direction.hpp"  // for Direction, opposite_direction
-#include "Inventory.hpp"  // for InventoryItem
-#include "Room.hpp"       // for Room, RoomConnections
-#include "Types.hpp"      // for RoomName
-#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+#include "AllocationCounter.hpp"  // for AllocationCounter
+#include "Direction.hpp"          // for Direction, ALL_DIRECTIONS
+#include "Inventory.hpp"          // for InventoryItem
+#include "Room.hpp"               // for Room, NamedConnections
+#include "Types.hpp"              // for RoomName, RoomId
+#include "gtest/gtest.h"          // for TEST, EXPECT_EQ
 
 #include <memory>         // for unique_ptr, make_unique
 #include <optional>       // for optional
@@ -20,16 +21,16 @@ namespace adv_sk::test {
   namespace {
     std::unique_ptr<Map> make_test_map() {
       const Room grand_hall("GrandHall", "Welcome to the Grand Hall.",
-                            {InventoryItem{.name = "chalice"}});
+                            {InventoryItem("chalice")});
       const Room armory("Armoury", "Welcome to the Armoury.",
-                        {InventoryItem{.name = "sword"}});
+                        {InventoryItem("sword")});
 
-      RoomConnections grand_hall_connections;
-      grand_hall_connections.add(Direction::North, "Armoury");
+      const NamedConnections grand_hall_connections{
+          {Direction::North, "Armoury"}};
 
       return std::make_unique<Map>(
           std::vector<Room>{grand_hall, armory},
-          std::unordered_map<RoomName, RoomConnections>{
+          std::unordered_map<RoomName, NamedConnections>{
               {"GrandHall", grand_hall_connections}});
     }
   }  // namespace
@@ -67,10 +68,72 @@ namespace adv_sk::test {
     auto map = make_test_map();
     auto& room = map->get_room("GrandHall");
     EXPECT_EQ(room.get_name(), "GrandHall");
-    room.add_to_inventory(InventoryItem{.name = "potion"});
+    room.add_to_inventory(InventoryItem("potion"));
     EXPECT_EQ(map->get_room("GrandHall").inventory().size(), 2);
   }
 
+  TEST(Map, roomsAreInternedInConstructionOrder) {
+    auto map = make_test_map();
+    EXPECT_EQ(map->size(), 2);
+    EXPECT_EQ(map->find_room("GrandHall"), std::optional<RoomId>(0));
+    EXPECT_EQ(map->find_room("Armoury"), std::optional<RoomId>(1));
+    EXPECT_FALSE(map->find_room("Dungeon").has_value());
+  }
+
+  TEST(Map, nextRoomByIdReturnsConnectedRoom) {
+    auto map = make_test_map();
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    const auto grand_hall = map->find_room("GrandHall").value();
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    const auto armoury = map->find_room("Armoury").value();
+    EXPECT_EQ(map->next_room(grand_hall, Direction::North),
+              std::optional<RoomId>(armoury));
+    EXPECT_EQ(map->next_room(armoury, Direction::South),
+              std::optional<RoomId>(grand_hall));
+    EXPECT_FALSE(map->next_room(grand_hall, Direction::West).has_value());
+  }
+
+  TEST(Map, availableExitsListsAllExitsOfRoom) {
+    auto map = make_test_map();
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    const auto grand_hall = map->find_room("GrandHall").value();
+    const auto exits = map->available_exits(grand_hall);
+    EXPECT_EQ(exits.size(), 1);
+    EXPECT_TRUE(exits.contains(Direction::North));
+  }
+
+  TEST(Map, idAndNameAccessorsAgree) {
+    auto map = make_test_map();
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    const auto armoury = map->find_room("Armoury").value();
+    EXPECT_EQ(map->get_room_name(armoury), "Armoury");
+    EXPECT_EQ(map->get_welcome_message(armoury), "Welcome to the Armoury.");
+    EXPECT_EQ(&map->get_room(armoury), &map->get_room("Armoury"));
+  }
+
+  TEST(Map, nextRoomDoesNotAllocate) {
+    auto map = make_test_map();
+    const RoomName grand_hall("GrandHall");
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    const auto grand_hall_id = map->find_room(grand_hall).value();
+
+    const AllocationCounter allocations;
+    for (const auto direction : ALL_DIRECTIONS) {
+      static_cast<void>(map->next_room(grand_hall, direction));
+      static_cast<void>(map->next_room(grand_hall_id, direction));
+    }
+    static_cast<void>(map->get_welcome_message(grand_hall_id));
+    static_cast<void>(map->get_room_name(grand_hall_id));
+    EXPECT_EQ(allocations.count(), 0);
+  }
+
+  TEST(Map, duplicateRoomNamesKeepFirstRoom) {
+    const Map map(
+        std::vector<Room>{Room("Hall", "first"), Room("Hall", "second")}, {});
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.get_welcome_message("Hall"), "first");
+  }
+
   TEST(Map, createMapFactoryReturnsValidMap) {
     auto map = create_map();
     EXPECT_EQ(map->get_welcome_message("GrandHall"),
@@ -0,0 +1,71 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include <cstddef>          // for size_t
+#include <format>           // for format_string, format_to
+#include <iterator>         // for back_inserter
+#include <memory_resource>  // for polymorphic_allocator
+#include <string>           // for pmr::string
+#include <string_view>      // for string_view
+#include <utility>          // for forward
+
+namespace adv_sk {
+
+  /**
+   * @brief Reusable text a session renders its replies into.
+   *
+   * Clearing keeps the capacity, so once the buffer has grown to the
+   * longest reply, rendering another one allocates nothing. Format strings
+   * are checked at compile time.
+   */
+  class MessageBuffer {
+   public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 256;
+
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    explicit MessageBuffer(std::size_t capacity = DEFAULT_CAPACITY,
+                           allocator_type allocator = {})
+        : _text(allocator) {
+      _text.reserve(capacity);
+    }
+
+    /// Starts a new message.
+    MessageBuffer& clear() {
+      _text.clear();
+      return *this;
+    }
+
+    MessageBuffer& append(std::string_view text) {
+      _text.append(text);
+      return *this;
+    }
+
+    template <typename... Args>
+    MessageBuffer& format(std::format_string<Args...> format, Args&&... args) {
+      std::format_to(std::back_inserter(_text), format,
+                     std::forward<Args>(args)...);
+      return *this;
+    }
+
+    /// Valid until the buffer is next changed.
+    [[nodiscard]] std::string_view view() const {
+      return _text;
+    }
+
+    [[nodiscard]] bool empty() const {
+      return _text.empty();
+    }
+
+    [[nodiscard]] std::size_t capacity() const {
+      return _text.capacity();
+    }
+
+   private:
+    std::pmr::string _text{};
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,41 @@
+// MessageBuffer unit tests
+
+#include "MessageBuffer.hpp"
+
+#include "AllocationCounter.hpp"  // for AllocationCounter
+#include "gtest/gtest.h"          // for TEST, EXPECT_EQ
+
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace adv_sk::test {
+
+  TEST(MessageBuffer, appendsAndFormatsInOrder) {
+    MessageBuffer buffer;
+    buffer.append("You take the ").format("{} ({})", "lamp", 3).append("\n");
+    EXPECT_EQ(buffer.view(), "You take the lamp (3)\n");
+  }
+
+  TEST(MessageBuffer, clearStartsANewMessage) {
+    MessageBuffer buffer;
+    buffer.append("first");
+    buffer.clear().append("second");
+    EXPECT_EQ(buffer.view(), "second");
+    EXPECT_TRUE(buffer.clear().empty());
+  }
+
+  TEST(MessageBuffer, reuseAfterGrowingDoesNotAllocate) {
+    MessageBuffer buffer(0);
+    const std::string long_name(MessageBuffer::DEFAULT_CAPACITY, 'x');
+    buffer.format("You drop the {}.\n", long_name);
+    const auto capacity = buffer.capacity();
+
+    const AllocationCounter allocations;
+    for (int round = 0; round < 10; ++round) {
+      buffer.clear().format("You drop the {}.\n", std::string_view(long_name));
+    }
+    EXPECT_EQ(allocations.count(), 0);
+    EXPECT_EQ(buffer.capacity(), capacity);
+  }
+
+}  // namespace adv_sk::test
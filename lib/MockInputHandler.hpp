@@ -3,8 +3,9 @@
 #include "IInputHandler.hpp"  // for IInputHandler, Action
 #include "gmock/gmock.h"      // for MOCK_METHOD
 
-#include <string>  // for string
-#include <vector>  // for vector
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
 
 namespace adv_sk::test {
 
@@ -12,11 +13,12 @@ namespace adv_sk::test {
   class MockInputHandler : public IInputHandler {
    public:
     MOCK_METHOD(Action, get_action, (), (override));
-    MOCK_METHOD(void, provide_directions,
-                (const std::vector<Direction>& directions), (override));
-    MOCK_METHOD(Direction, get_direction, (), (override));
+    MOCK_METHOD(void, provide_directions, (DirectionSet directions),
+                (override));
+    MOCK_METHOD(std::optional<Direction>, get_direction, (), (override));
     MOCK_METHOD(std::string, get_item_name, (), (override));
-    MOCK_METHOD(void, provide_message, (const std::string& message),
+    MOCK_METHOD(std::string, get_room_name, (), (override));
+    MOCK_METHOD(void, provide_message, (std::string_view message),
                 (override));
   };
   // NOLINTEND(misc-non-private-member-variables-in-classes)
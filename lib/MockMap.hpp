@@ -1,24 +1,36 @@
 #pragma once
 
+#include "Direction.hpp"  // for Direction, DirectionSet
 #include "IMap.hpp"       // for IMap
 #include "Room.hpp"       // for Room
-#include "Types.hpp"      // for RoomName
+#include "Types.hpp"      // for RoomName, RoomId
 #include "gmock/gmock.h"  // for MOCK_METHOD
 
-#include <optional>  // for optional
-#include <string>    // for string
+#include <optional>     // for optional
+#include <string_view>  // for string_view
 
 namespace adv_sk::test {
 
   // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
   class MockMap : public IMap {
    public:
-    MOCK_METHOD(std::optional<RoomName>, next_room,
+    MOCK_METHOD(std::optional<RoomId>, find_room, (const RoomName& room),
+                (const, override));
+    MOCK_METHOD(std::optional<std::string_view>, next_room,
                 (const RoomName& current_room, Direction direction),
                 (override));
-    MOCK_METHOD(std::string, get_welcome_message, (const RoomName& room),
+    MOCK_METHOD(std::optional<RoomId>, next_room,
+                (RoomId current_room, Direction direction), (override));
+    MOCK_METHOD(DirectionSet, available_exits, (RoomId room),
+                (const, override));
+    MOCK_METHOD(std::string_view, get_welcome_message, (const RoomName& room),
+                (const, override));
+    MOCK_METHOD(std::string_view, get_welcome_message, (RoomId room),
+                (const, override));
+    MOCK_METHOD(std::string_view, get_room_name, (RoomId room),
                 (const, override));
     MOCK_METHOD(Room&, get_room, (const RoomName& room), (override));
+    MOCK_METHOD(Room&, get_room, (RoomId room), (override));
   };
   // NOLINTEND(misc-non-private-member-variables-in-classes)
 
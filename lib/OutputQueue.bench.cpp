@@ -0,0 +1,54 @@
+// OutputQueue benchmarks
+
+#include "OutputQueue.hpp"
+
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <string_view>  // for string_view
+
+#include <fcntl.h>   // for open, O_WRONLY
+#include <unistd.h>  // for write, close
+
+namespace adv_sk::bench {
+
+  namespace {
+    constexpr std::string_view MESSAGE =
+        "You search the room. You found a golden chalice!\n";
+
+    /// What the game did before: one write() per message.
+    void BM_WritePerMessage(benchmark::State& state) {
+      const int sink = ::open("/dev/null", O_WRONLY);
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(::write(sink, MESSAGE.data(), MESSAGE.size()));
+      }
+      close(sink);
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_WritePerMessage);
+
+    /// Time the pusher spends per message; the writer thread batches them.
+    void BM_OutputQueuePush(benchmark::State& state) {
+      const int sink = ::open("/dev/null", O_WRONLY);
+      {
+        OutputQueue queue(sink, OutputQueue::DEFAULT_CAPACITY,
+                          static_cast<OverflowPolicy>(state.range(0)));
+        for (auto _ : state) {
+          queue.push(MESSAGE);
+        }
+        queue.flush();
+        const auto stats = queue.stats();
+        state.counters["per_batch"] =
+            stats.batches > 0 ? static_cast<double>(stats.pushed) /
+                                    static_cast<double>(stats.batches)
+                              : 0.0;
+      }
+      close(sink);
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_OutputQueuePush)
+        ->Arg(static_cast<int>(OverflowPolicy::Block))
+        ->Arg(static_cast<int>(OverflowPolicy::DropOldest))
+        ->Arg(static_cast<int>(OverflowPolicy::Coalesce));
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,254 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "OutputQueue.hpp"
+
+#include <algorithm>  // for max, min
+#include <array>      // for array
+#include <cerrno>     // for errno, EINTR
+#include <stdexcept>  // for runtime_error
+#include <utility>    // for swap
+#include <vector>     // for erase
+
+#include <sys/uio.h>  // for iovec, writev
+
+namespace adv_sk {
+
+  OutputWriter::OutputWriter(std::size_t threads) {
+    threads = std::max<std::size_t>(threads, 1);
+    _threads.reserve(threads);
+    while (_threads.size() < threads) {
+      _threads.emplace_back([this] { run(); });
+    }
+  }
+
+  OutputWriter::~OutputWriter() {
+    {
+      const std::lock_guard lock(_mutex);
+      _stopping = true;
+      _wake.notify_all();
+    }
+    for (auto& thread : _threads) {
+      thread.join();
+    }
+  }
+
+  OutputWriter& OutputWriter::shared() {
+    static OutputWriter writer(SHARED_THREADS);
+    return writer;
+  }
+
+  void OutputWriter::attach(OutputQueue& queue) {
+    const std::lock_guard lock(_mutex);
+    _queues.push_back(&queue);
+  }
+
+  void OutputWriter::detach(OutputQueue& queue) {
+    {
+      const std::lock_guard lock(_mutex);
+      std::erase(_queues, &queue);
+    }
+    // Claims are only made under the mutex, so no new one can follow.
+    while (queue._busy) {
+      queue._busy.wait(true);
+    }
+  }
+
+  void OutputWriter::wake() {
+    const std::lock_guard lock(_mutex);
+    ++_wakeups;
+    _wake.notify_one();
+  }
+
+  void OutputWriter::run() {
+    std::unique_lock lock(_mutex);
+    while (!_stopping) {
+      // Counted before looking, so a push we miss sees us and wakes us.
+      _sleepers.fetch_add(1);
+      const auto wakeups = _wakeups;
+      auto* const queue = claim_locked();
+      if (queue == nullptr) {
+        _wake.wait(lock,
+                   [&] { return _stopping || _wakeups != wakeups; });
+      }
+      _sleepers.fetch_sub(1);
+      if (queue != nullptr) {
+        lock.unlock();
+        queue->write_out();
+        lock.lock();
+      }
+    }
+  }
+
+  OutputQueue* OutputWriter::claim_locked() {
+    for (std::size_t checked = 0; checked < _queues.size(); ++checked) {
+      auto* const queue = _queues[_next++ % _queues.size()];
+      if (queue->claimable() && queue->try_claim()) {
+        return queue;
+      }
+    }
+    return nullptr;
+  }
+
+  OutputQueue::OutputQueue(int descriptor, std::size_t capacity,
+                           OverflowPolicy policy, OutputWriter& writer)
+      : _descriptor(descriptor),
+        _capacity(std::max<std::size_t>(capacity, 1)),
+        _policy(policy),
+        _slots(std::make_unique<Slot[]>(_capacity)),
+        _writer(writer),
+        _batch(std::min(MAX_BATCH, _capacity)) {
+    _writer.attach(*this);
+  }
+
+  OutputQueue::~OutputQueue() {
+    drain();
+    _writer.detach(*this);
+  }
+
+  void OutputQueue::enqueue(std::string_view text, std::string_view end) {
+    const auto head = _head.load(std::memory_order_relaxed);
+    for (auto tail = _tail.load(); head - tail >= _capacity;
+         tail = _tail.load()) {
+      if (_policy == OverflowPolicy::Block) {
+        _tail.wait(tail);
+      } else if (_policy == OverflowPolicy::DropOldest) {
+        // Winning the race for the oldest slot also frees it for us.
+        if (_tail.compare_exchange_strong(tail, tail + 1)) {
+          _dropped.fetch_add(1, std::memory_order_relaxed);
+          break;
+        }
+      } else if (try_coalesce(head, text, end)) {
+        _pushed.fetch_add(1, std::memory_order_relaxed);
+        _coalesced.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+
+    // The slot's previous message may still be being swapped out.
+    while (_swapping) {
+      std::this_thread::yield();
+    }
+    slot(head).text.assign(text).append(end);
+    _head.store(head + 1);
+    _pushed.fetch_add(1, std::memory_order_relaxed);
+
+    const auto depth = static_cast<std::size_t>(head + 1 - _tail.load());
+    if (depth > _peak_depth.load(std::memory_order_relaxed)) {
+      _peak_depth.store(depth, std::memory_order_relaxed);
+    }
+    _writer.wake_if_sleeping();
+  }
+
+  bool OutputQueue::try_coalesce(std::uint64_t head, std::string_view text,
+                                 std::string_view end) {
+    auto& newest = slot(head - 1);
+    // Pairs with the writer moving _tail and then reading `editing`:
+    // either we see the message taken, or the writer waits for us.
+    newest.editing = true;
+    const bool unsent = _tail.load() < head;
+    if (unsent) {
+      newest.text.append(text).append(end);
+    }
+    newest.editing = false;
+    return unsent;
+  }
+
+  void OutputQueue::flush() {
+    drain();
+    if (_failed) {
+      throw std::runtime_error("Cannot write output");
+    }
+  }
+
+  void OutputQueue::drain() {
+    const auto head = _head.load(std::memory_order_relaxed);
+    while (_tail.load() != head || _busy) {
+      if (_busy) {
+        _busy.wait(true);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  OutputStats OutputQueue::stats() const {
+    return OutputStats{
+        .depth = depth(),
+        .peak_depth = _peak_depth.load(std::memory_order_relaxed),
+        .pushed = _pushed.load(std::memory_order_relaxed),
+        .dropped = _dropped.load(std::memory_order_relaxed),
+        .coalesced = _coalesced.load(std::memory_order_relaxed),
+        .batches = _batches.load(std::memory_order_relaxed),
+        .bytes_written = _bytes_written.load(std::memory_order_relaxed),
+    };
+  }
+
+  void OutputQueue::write_out() {
+    auto tail = _tail.load();
+    const auto head = _head.load();
+    const auto count = static_cast<std::size_t>(
+        std::min<std::uint64_t>(head - tail, _batch.size()));
+    _swapping = true;
+    // DropOldest may have moved the tail first, or emptied the ring.
+    const bool taken =
+        count != 0 && _tail.compare_exchange_strong(tail, tail + count);
+    if (taken) {
+      _tail.notify_one();
+      for (std::size_t index = 0; index < count; ++index) {
+        auto& message = slot(tail + index);
+        while (message.editing) {
+          std::this_thread::yield();
+        }
+        std::swap(message.text, _batch[index]);
+      }
+    }
+    _swapping = false;
+
+    if (taken) {
+      if (!_failed && !write_batch(_batch, count)) {
+        _failed = true;
+      }
+      _batches.fetch_add(1, std::memory_order_relaxed);
+    }
+    _busy = false;
+    _busy.notify_all();
+  }
+
+  bool OutputQueue::write_batch(std::vector<std::string>& batch,
+                                std::size_t count) {
+    std::array<iovec, MAX_BATCH> pieces{};
+    for (std::size_t index = 0; index < count; ++index) {
+      pieces[index] = iovec{.iov_base = batch[index].data(),
+                            .iov_len = batch[index].size()};
+    }
+
+    auto* next = pieces.data();
+    auto* const end = pieces.data() + count;
+    while (next != end) {
+      const auto written =
+          ::writev(_descriptor, next, static_cast<int>(end - next));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      _bytes_written.fetch_add(static_cast<std::uint64_t>(written),
+                               std::memory_order_relaxed);
+      // Skip what was written, which may end inside a message.
+      auto remaining = static_cast<std::size_t>(written);
+      while (next != end && remaining >= next->iov_len) {
+        remaining -= next->iov_len;
+        ++next;
+      }
+      if (next != end) {
+        next->iov_base = static_cast<char*>(next->iov_base) + remaining;
+        next->iov_len -= remaining;
+      }
+    }
+    return true;
+  }
+
+}  // namespace adv_sk
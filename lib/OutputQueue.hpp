@@ -0,0 +1,233 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include <algorithm>           // for min
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <cstdint>             // for uint8_t, uint64_t
+#include <memory>              // for unique_ptr
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <string_view>         // for string_view
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+namespace adv_sk {
+
+  /// What OutputQueue::push() does when every slot holds an unsent message.
+  enum class OverflowPolicy : std::uint8_t {
+    /// Wait for the writer to take messages off the ring.
+    Block,
+    /// Discard the oldest message the writer has not taken yet.
+    DropOldest,
+    /// Append to the newest unsent message instead of taking a slot.
+    Coalesce,
+  };
+
+  struct OutputStats {
+    /// Messages waiting in the ring right now.
+    std::size_t depth{0};
+    std::size_t peak_depth{0};
+    std::uint64_t pushed{0};
+    std::uint64_t dropped{0};
+    std::uint64_t coalesced{0};
+    /// writev() batches the writer has finished and the bytes they held.
+    std::uint64_t batches{0};
+    std::uint64_t bytes_written{0};
+  };
+
+  class OutputQueue;
+
+  /**
+   * @brief A few threads that write out every attached OutputQueue.
+   *
+   * The threads take turns over the queues, each claiming a queue with
+   * unsent messages, writing one batch of it and moving on, so a thousand
+   * sessions need no more threads than one. A descriptor that stalls holds
+   * up only the thread writing to it. With nothing to write the threads
+   * sleep until a push wakes one.
+   */
+  class OutputWriter {
+   public:
+    /// What shared() runs: one stalled client leaves the other thread.
+    static constexpr std::size_t SHARED_THREADS = 2;
+
+    explicit OutputWriter(std::size_t threads = 1);
+
+    OutputWriter(const OutputWriter&) = delete;
+    OutputWriter& operator=(const OutputWriter&) = delete;
+    OutputWriter(OutputWriter&&) = delete;
+    OutputWriter& operator=(OutputWriter&&) = delete;
+
+    /// Every queue must be gone first.
+    ~OutputWriter();
+
+    /// The writer queues use unless they are given another.
+    static OutputWriter& shared();
+
+   private:
+    friend class OutputQueue;
+
+    void attach(OutputQueue& queue);
+
+    /// Returns once no thread is writing the queue.
+    void detach(OutputQueue& queue);
+
+    /// Called by push() after publishing a message.
+    void wake_if_sleeping() {
+      if (_sleepers.load() != 0) {
+        wake();
+      }
+    }
+
+    void wake();
+
+    void run();
+
+    /// The next queue, after the last one served, with a batch to write.
+    OutputQueue* claim_locked();
+
+    std::vector<OutputQueue*> _queues{};
+    std::size_t _next{0};
+    /// Threads about to sleep; push() only takes the mutex if there are.
+    std::atomic<std::size_t> _sleepers{0};
+    std::uint64_t _wakeups{0};
+    bool _stopping{false};
+    std::mutex _mutex{};
+    std::condition_variable _wake{};
+    std::vector<std::thread> _threads{};
+  };
+
+  /**
+   * @brief Hands messages to an OutputWriter through a bounded ring.
+   *
+   * One thread pushes; a writer thread takes every waiting message at once
+   * (up to MAX_BATCH), frees their slots and writes them, each followed by
+   * a newline, with one writev(). The slots are reused strings, swapped out
+   * rather than copied, so the pusher never waits for the descriptor. When
+   * the ring is full it follows the OverflowPolicy.
+   *
+   * A failed write is remembered and thrown from flush(); later messages
+   * are discarded so the pusher never waits on a dead descriptor.
+   */
+  class OutputQueue {
+   public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 256;
+    static constexpr std::size_t MAX_BATCH = 64;
+
+    /// Writes to a descriptor the caller keeps open.
+    explicit OutputQueue(int descriptor,
+                         std::size_t capacity = DEFAULT_CAPACITY,
+                         OverflowPolicy policy = OverflowPolicy::Block,
+                         OutputWriter& writer = OutputWriter::shared());
+
+    OutputQueue(const OutputQueue&) = delete;
+    OutputQueue& operator=(const OutputQueue&) = delete;
+    OutputQueue(OutputQueue&&) = delete;
+    OutputQueue& operator=(OutputQueue&&) = delete;
+
+    /// Writes out what is queued and detaches from the writer.
+    ~OutputQueue();
+
+    /// Only ever called by one thread at a time.
+    void push(std::string_view message) {
+      enqueue(message, "\n");
+    }
+
+    /// Like push(), but writes the bytes as they are, with no line end.
+    void push_bytes(std::string_view bytes) {
+      enqueue(bytes, {});
+    }
+
+    /// Waits until everything pushed so far is written or dropped; throws
+    /// std::runtime_error if a write has failed.
+    void flush();
+
+    [[nodiscard]] std::size_t depth() const {
+      // Tail first: both only grow, so a head read after it is never behind.
+      // It may be ahead by more than the queue holds if this thread stalls
+      // between the loads, hence the clamp.
+      const auto tail = _tail.load();
+      return std::min(static_cast<std::size_t>(_head.load() - tail),
+                      _capacity);
+    }
+
+    [[nodiscard]] OutputStats stats() const;
+
+    [[nodiscard]] std::size_t capacity() const {
+      return _capacity;
+    }
+
+   private:
+    friend class OutputWriter;
+
+    struct alignas(64) Slot {
+      std::string text{};
+      /// Set while push() appends to an unsent message.
+      std::atomic<bool> editing{false};
+    };
+
+    [[nodiscard]] Slot& slot(std::uint64_t index) {
+      return _slots[index % _capacity];
+    }
+
+    /// Queues `text` followed by `end`.
+    void enqueue(std::string_view text, std::string_view end);
+
+    /// Appends to the newest message unless the writer has taken it.
+    bool try_coalesce(std::uint64_t head, std::string_view text,
+                      std::string_view end);
+
+    /// Unsent messages no writer thread has claimed.
+    [[nodiscard]] bool claimable() const {
+      return !_busy.load() && _head.load() != _tail.load();
+    }
+
+    /// Makes the calling writer thread the only one writing the queue.
+    bool try_claim() {
+      bool idle = false;
+      return _busy.compare_exchange_strong(idle, true);
+    }
+
+    /// Writes one batch of a claimed queue and lets it go.
+    void write_out();
+
+    /// Waits until everything pushed so far is written or dropped.
+    void drain();
+
+    /// Writes the first `count` texts of `batch`; false if the write failed.
+    bool write_batch(std::vector<std::string>& batch, std::size_t count);
+
+    int _descriptor;
+    std::size_t _capacity;
+    OverflowPolicy _policy;
+    std::unique_ptr<Slot[]> _slots;
+    OutputWriter& _writer;
+    /// Only touched by the writer thread holding the claim.
+    std::vector<std::string> _batch;
+
+    /// Next index to push; only the pusher stores it.
+    alignas(64) std::atomic<std::uint64_t> _head{0};
+    /// Oldest unsent index; the writer takes messages and DropOldest
+    /// discards them by moving it forward.
+    alignas(64) std::atomic<std::uint64_t> _tail{0};
+    /// Set while the writer swaps taken messages out of their slots.
+    std::atomic<bool> _swapping{false};
+    /// Set while a writer thread holds the queue, from claiming it until
+    /// its batch is written.
+    std::atomic<bool> _busy{false};
+
+    alignas(64) std::atomic<std::uint64_t> _pushed{0};
+    std::atomic<std::uint64_t> _dropped{0};
+    std::atomic<std::uint64_t> _coalesced{0};
+    std::atomic<std::size_t> _peak_depth{0};
+    std::atomic<std::uint64_t> _batches{0};
+    std::atomic<std::uint64_t> _bytes_written{0};
+    std::atomic<bool> _failed{false};
+  };
+
+}  // namespace adv_sk
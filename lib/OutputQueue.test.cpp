@@ -0,0 +1,224 @@
+// OutputQueue unit tests
+
+#include "OutputQueue.hpp"
+
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <algorithm>    // for max
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <memory>       // for unique_ptr, make_unique
+#include <stdexcept>    // for runtime_error
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <thread>       // for thread, yield
+#include <vector>       // for vector
+
+#include <fcntl.h>   // for fcntl, F_SETPIPE_SZ
+#include <unistd.h>  // for pipe, read, close
+
+namespace adv_sk::test {
+
+  namespace {
+    /// A pipe holding one page, so a bigger message stalls the writer.
+    class SmallPipe {
+     public:
+      SmallPipe() {
+        if (::pipe(_ends.data()) != 0) {
+          throw std::runtime_error("pipe failed");
+        }
+        fcntl(_ends[1], F_SETPIPE_SZ, PAGE);
+      }
+
+      SmallPipe(const SmallPipe&) = delete;
+      SmallPipe& operator=(const SmallPipe&) = delete;
+      SmallPipe(SmallPipe&&) = delete;
+      SmallPipe& operator=(SmallPipe&&) = delete;
+
+      ~SmallPipe() {
+        close_write();
+        close(_ends[0]);
+      }
+
+      [[nodiscard]] int write_end() const {
+        return _ends[1];
+      }
+
+      void close_write() {
+        if (_ends[1] >= 0) {
+          close(_ends[1]);
+          _ends[1] = -1;
+        }
+      }
+
+      /// Reads until the write end is closed.
+      std::string drain() const {
+        std::string text;
+        std::array<char, PAGE> block{};
+        for (ssize_t count = 0;
+             (count = ::read(_ends[0], block.data(), block.size())) > 0;) {
+          text.append(block.data(), static_cast<std::size_t>(count));
+        }
+        return text;
+      }
+
+      static constexpr int PAGE = 4096;
+
+     private:
+      std::array<int, 2> _ends{-1, -1};
+    };
+
+    /// Queues a message the pipe cannot hold and waits for the writer to
+    /// take it, leaving the writer stuck in writev().
+    std::string stall(OutputQueue& queue) {
+      const std::string large(SmallPipe::PAGE * 4, 'x');
+      queue.push(large);
+      while (queue.depth() != 0) {
+        std::this_thread::yield();
+      }
+      return large + "\n";
+    }
+
+    /// Flushes the queue while another thread empties the pipe.
+    std::string flush_and_read(OutputQueue& queue, SmallPipe& pipe) {
+      std::string text;
+      std::thread reader([&] { text = pipe.drain(); });
+      queue.flush();
+      pipe.close_write();
+      reader.join();
+      return text;
+    }
+
+    std::string numbered(std::size_t first, std::size_t last) {
+      std::string text;
+      for (auto index = first; index < last; ++index) {
+        text.append("m" + std::to_string(index)).push_back('\n');
+      }
+      return text;
+    }
+
+    void push_numbered(OutputQueue& queue, std::size_t count) {
+      for (std::size_t index = 0; index < count; ++index) {
+        queue.push("m" + std::to_string(index));
+      }
+    }
+  }  // namespace
+
+  TEST(OutputQueue, writesEveryMessageOnItsOwnLine) {
+    SmallPipe pipe;
+    std::string text;
+    {
+      OutputQueue queue(pipe.write_end());
+      queue.push("You take the lamp");
+      queue.push("");
+      queue.push("What do you want to do?");
+      text = flush_and_read(queue, pipe);
+
+      const auto stats = queue.stats();
+      EXPECT_EQ(stats.pushed, 3);
+      EXPECT_EQ(stats.depth, 0);
+      EXPECT_EQ(stats.bytes_written, text.size());
+    }
+    EXPECT_EQ(text, "You take the lamp\n\nWhat do you want to do?\n");
+  }
+
+  TEST(OutputQueue, dropOldestKeepsTheNewestMessages) {
+    SmallPipe pipe;
+    OutputQueue queue(pipe.write_end(), 4, OverflowPolicy::DropOldest);
+    const auto large = stall(queue);
+
+    push_numbered(queue, 10);
+    EXPECT_EQ(queue.depth(), 4);
+    EXPECT_EQ(queue.stats().dropped, 6);
+
+    EXPECT_EQ(flush_and_read(queue, pipe), large + numbered(6, 10));
+  }
+
+  TEST(OutputQueue, coalesceKeepsEveryMessage) {
+    SmallPipe pipe;
+    OutputQueue queue(pipe.write_end(), 2, OverflowPolicy::Coalesce);
+    const auto large = stall(queue);
+
+    push_numbered(queue, 5);
+    EXPECT_EQ(queue.depth(), 2);
+    EXPECT_EQ(queue.stats().coalesced, 3);
+    EXPECT_EQ(queue.stats().dropped, 0);
+
+    EXPECT_EQ(flush_and_read(queue, pipe), large + numbered(0, 5));
+  }
+
+  TEST(OutputQueue, blockWaitsForTheWriter) {
+    SmallPipe pipe;
+    OutputQueue queue(pipe.write_end(), 2, OverflowPolicy::Block);
+    const auto large = stall(queue);
+
+    std::thread pusher([&] { push_numbered(queue, 50); });
+    std::string text;
+    std::thread reader([&] { text = pipe.drain(); });
+    pusher.join();
+    queue.flush();
+    pipe.close_write();
+    reader.join();
+
+    EXPECT_EQ(text, large + numbered(0, 50));
+    EXPECT_LE(queue.stats().peak_depth, 2);
+  }
+
+  TEST(OutputQueue, depthReadWhileTheWriterDrainsStaysInRange) {
+    constexpr std::size_t CAPACITY = 4;
+    SmallPipe pipe;
+    OutputQueue queue(pipe.write_end(), CAPACITY, OverflowPolicy::Block);
+    std::thread reader([&] { static_cast<void>(pipe.drain()); });
+    std::thread pusher([&] { push_numbered(queue, 20'000); });
+
+    std::size_t deepest = 0;
+    for (int reads = 0; reads < 100'000; ++reads) {
+      deepest = std::max(deepest, queue.depth());
+    }
+    pusher.join();
+    queue.flush();
+    pipe.close_write();
+    reader.join();
+    EXPECT_LE(deepest, CAPACITY);
+  }
+
+  TEST(OutputQueue, aStalledQueueLeavesTheOtherWriterThread) {
+    OutputWriter writer(2);
+    SmallPipe stalled_pipe;
+    SmallPipe pipe;
+    OutputQueue stalled(stalled_pipe.write_end(), 4, OverflowPolicy::Block,
+                        writer);
+    OutputQueue queue(pipe.write_end(), 4, OverflowPolicy::Block, writer);
+    const auto large = stall(stalled);
+
+    queue.push("still written");
+    EXPECT_EQ(flush_and_read(queue, pipe), "still written\n");
+    EXPECT_EQ(flush_and_read(stalled, stalled_pipe), large);
+  }
+
+  TEST(OutputQueue, oneWriterThreadServesManyQueues) {
+    OutputWriter writer(1);
+    std::array<SmallPipe, 8> pipes;
+    std::vector<std::unique_ptr<OutputQueue>> queues;
+    for (auto& pipe : pipes) {
+      queues.push_back(std::make_unique<OutputQueue>(
+          pipe.write_end(), 4, OverflowPolicy::Block, writer));
+    }
+    for (std::size_t index = 0; index < queues.size(); ++index) {
+      push_numbered(*queues[index], index + 1);
+    }
+    for (std::size_t index = 0; index < queues.size(); ++index) {
+      EXPECT_EQ(flush_and_read(*queues[index], pipes[index]),
+                numbered(0, index + 1));
+    }
+  }
+
+  TEST(OutputQueue, flushReportsAFailedWrite) {
+    OutputQueue queue(-1);
+    queue.push("nowhere to go");
+    EXPECT_THROW(queue.flush(), std::runtime_error);
+    queue.push("still accepted");
+    EXPECT_THROW(queue.flush(), std::runtime_error);
+  }
+
+}  // namespace adv_sk::test
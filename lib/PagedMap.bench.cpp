@@ -0,0 +1,88 @@
+// PagedMap benchmarks
+
+#include "PagedMap.hpp"
+
+#include "BenchmarkSupport.hpp"   // for MIN_ROOMS, MAX_ROOMS
+#include "Direction.hpp"          // for Direction, DIRECTION_COUNT
+#include "Types.hpp"              // for RoomId
+#include "WorldGenerator.hpp"     // for generate_map, GeneratorOptions
+#include "WorldText.hpp"          // for write_world_text
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <filesystem>  // for path, temp_directory_path, remove
+#include <fstream>     // for ofstream
+#include <string>      // for to_string
+
+namespace adv_sk::bench {
+
+  namespace {
+    constexpr std::size_t BUDGET_BYTES = 1024 * 1024;
+
+    /// A generated grid world written as text, removed again when done.
+    class TextWorldFile {
+     public:
+      explicit TextWorldFile(std::size_t room_count)
+          : _path(std::filesystem::temp_directory_path() /
+                  ("adv_sk_bench_" + std::to_string(room_count) +
+                   ".world")) {
+        std::ofstream out(_path, std::ios::binary | std::ios::trunc);
+        write_world_text(
+            *generate_map(GeneratorOptions{.room_count = room_count}), out);
+      }
+
+      TextWorldFile(const TextWorldFile&) = delete;
+      TextWorldFile& operator=(const TextWorldFile&) = delete;
+      TextWorldFile(TextWorldFile&&) = delete;
+      TextWorldFile& operator=(TextWorldFile&&) = delete;
+
+      ~TextWorldFile() {
+        std::filesystem::remove(_path);
+      }
+
+      [[nodiscard]] const std::filesystem::path& path() const {
+        return _path;
+      }
+
+     private:
+      std::filesystem::path _path;
+    };
+
+    void BM_PagedMapScan(benchmark::State& state) {
+      const TextWorldFile file(static_cast<std::size_t>(state.range(0)));
+      for (auto _ : state) {
+        const PagedMap map(file.path(), BUDGET_BYTES);
+        benchmark::DoNotOptimize(map.size());
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_PagedMapScan)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS)
+        ->Unit(benchmark::kMillisecond);
+
+    /// Random walk that reads the message of every room it enters.
+    void BM_PagedMapWalk(benchmark::State& state) {
+      const TextWorldFile file(static_cast<std::size_t>(state.range(0)));
+      PagedMap map(file.path(), BUDGET_BYTES);
+      RoomId room = 0;
+      std::uint64_t random = 1;
+      for (auto _ : state) {
+        random = (random * 6364136223846793005ULL) + 1442695040888963407ULL;
+        const auto direction =
+            ALL_DIRECTIONS[(random >> 62U) % DIRECTION_COUNT];
+        room = map.next_room(room, direction).value_or(room);
+        benchmark::DoNotOptimize(map.get_welcome_message(room));
+      }
+      state.SetItemsProcessed(state.iterations());
+      state.counters["resident_rooms"] =
+          static_cast<double>(map.resident_rooms());
+      state.counters["loads"] = static_cast<double>(map.loads());
+    }
+    BENCHMARK(BM_PagedMapWalk)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS);
+  }  // namespace
+
+}  // namespace adv_sk::bench
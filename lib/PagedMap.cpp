@@ -0,0 +1,302 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "PagedMap.hpp"
+
+#include "WorldText.hpp"  // for parse_world_line, WorldDirective
+
+#include <algorithm>    // for max
+#include <bit>          // for bit_ceil
+#include <functional>   // for hash
+#include <ios>          // for streamoff
+#include <stdexcept>    // for runtime_error, out_of_range
+#include <string>       // for string, getline, to_string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+namespace adv_sk {
+
+  namespace {
+    constexpr std::size_t MIN_NAME_SLOTS = 16;
+    /// Bookkeeping of one resident room: map node, LRU node, vectors.
+    constexpr std::size_t RESIDENT_OVERHEAD = 96;
+
+    std::size_t hash_of(std::string_view name) {
+      return std::hash<std::string_view>{}(name);
+    }
+
+    [[noreturn]] void fail(const std::string& reason,
+                           std::size_t line_number) {
+      throw std::runtime_error("World line " + std::to_string(line_number) +
+                               ": " + reason);
+    }
+
+    std::size_t footprint(const Room& room) {
+      std::size_t bytes = sizeof(Room) + RESIDENT_OVERHEAD +
+                          room.get_name().size() + room.get_message().size();
+      // Item names and use messages live in the shared ItemCatalog.
+      return bytes + (room.inventory().size() * sizeof(InventoryItem));
+    }
+
+    /// An exit as written, resolved once every room name is known.
+    struct PendingExit {
+      RoomId from;
+      Direction direction;
+      std::size_t target_hash;
+      std::uint64_t line_offset;
+    };
+  }  // namespace
+
+  PagedMap::PagedMap(const std::filesystem::path& path,
+                     std::size_t budget_bytes)
+      : _budget_bytes(budget_bytes), _file(path, std::ios::binary) {
+    if (!_file) {
+      throw std::runtime_error("Cannot open world: " + path.string());
+    }
+    scan();
+  }
+
+  void PagedMap::scan() {
+    std::vector<PendingExit> exits;
+    std::string line;
+    std::uint64_t offset = 0;
+    std::size_t line_number = 0;
+    auto current = INVALID_ROOM_ID;
+    bool duplicate = false;
+    bool has_item = false;
+
+    while (std::getline(_file, line)) {
+      const auto line_offset = offset;
+      offset += line.size() + 1;
+      const auto directive = parse_world_line(line, ++line_number);
+      if (directive.kind == WorldDirective::Kind::None) {
+        continue;
+      }
+      if (directive.kind == WorldDirective::Kind::Room) {
+        const auto hash = hash_of(directive.text);
+        // As in Map, the first room of a name wins and repeats are ignored.
+        if (find_by_name(directive.text, hash, true).has_value()) {
+          duplicate = true;
+        } else {
+          if (find_by_name(directive.text, hash, false).has_value()) {
+            _colliding_hashes.insert(hash);
+          }
+          current = static_cast<RoomId>(_offsets.size());
+          _offsets.push_back(line_offset);
+          _name_hashes.push_back(hash);
+          index_name(hash, current);
+          duplicate = false;
+        }
+        has_item = false;
+        continue;
+      }
+      if (current == INVALID_ROOM_ID) {
+        fail("directive before any room", line_number);
+      }
+      if (directive.kind == WorldDirective::Kind::Item) {
+        has_item = true;
+      } else if (directive.kind == WorldDirective::Kind::Use && !has_item) {
+        fail("use before any item", line_number);
+      } else if (directive.kind == WorldDirective::Kind::Exit && !duplicate) {
+        exits.push_back({current, directive.direction,
+                         hash_of(directive.text), line_offset});
+      }
+    }
+    _file.clear();
+
+    _connections.assign(_offsets.size(), RoomConnections{});
+    for (const auto& exit : exits) {
+      // Exits keep no text; the name is read back only when it is needed.
+      const auto target_name = [&] {
+        return parse_world_line(read_line(exit.line_offset), 0).text;
+      };
+      const bool collides = _colliding_hashes.contains(exit.target_hash);
+      const auto target =
+          find_by_name(collides ? target_name() : std::string(),
+                       exit.target_hash, collides);
+      if (!target.has_value()) {
+        throw std::out_of_range("Unknown room: " + target_name());
+      }
+      _connections[exit.from].add(exit.direction, target.value());
+      _connections[target.value()].add(opposite_direction(exit.direction),
+                                       exit.from);
+    }
+  }
+
+  std::optional<RoomId> PagedMap::find_by_name(std::string_view name,
+                                               std::size_t hash,
+                                               bool compare) const {
+    if (_name_slots.empty()) {
+      return std::nullopt;
+    }
+    const auto mask = _name_slots.size() - 1;
+    for (auto slot = hash & mask;; slot = (slot + 1) & mask) {
+      const auto room = _name_slots[slot];
+      if (room == INVALID_ROOM_ID) {
+        return std::nullopt;
+      }
+      if (_name_hashes[room] == hash &&
+          (!compare || read_name(room) == name)) {
+        return room;
+      }
+    }
+  }
+
+  void PagedMap::index_name(std::size_t hash, RoomId room) {
+    const auto place = [this](std::size_t name_hash, RoomId id) {
+      const auto mask = _name_slots.size() - 1;
+      auto slot = name_hash & mask;
+      while (_name_slots[slot] != INVALID_ROOM_ID) {
+        slot = (slot + 1) & mask;
+      }
+      _name_slots[slot] = id;
+    };
+    // Keeps the load factor at or below one half.
+    if ((std::size_t{room} + 1) * 2 > _name_slots.size()) {
+      _name_slots.assign(
+          std::bit_ceil(std::max(MIN_NAME_SLOTS, (std::size_t{room} + 1) * 2)),
+          INVALID_ROOM_ID);
+      for (RoomId indexed = 0; indexed < room; ++indexed) {
+        place(_name_hashes[indexed], indexed);
+      }
+    }
+    place(hash, room);
+  }
+
+  std::string PagedMap::read_line(std::uint64_t offset) const {
+    const auto position = _file.tellg();
+    _file.seekg(static_cast<std::streamoff>(offset));
+    std::string line;
+    std::getline(_file, line);
+    _file.clear();
+    _file.seekg(position);
+    return line;
+  }
+
+  RoomName PagedMap::read_name(RoomId room) const {
+    if (const auto resident = _resident.find(room);
+        resident != _resident.end()) {
+      return RoomName(resident->second.room.get_name());
+    }
+    return parse_world_line(read_line(_offsets[room]), 0).text;
+  }
+
+  Room PagedMap::read_room(RoomId room) const {
+    _file.seekg(static_cast<std::streamoff>(_offsets[room]));
+    std::string line;
+    std::getline(_file, line);
+    auto name = parse_world_line(line, 0).text;
+
+    std::string message;
+    std::vector<ItemDefinition> items;
+    while (std::getline(_file, line)) {
+      auto directive = parse_world_line(line, 0);
+      if (directive.kind == WorldDirective::Kind::Room) {
+        break;
+      }
+      if (directive.kind == WorldDirective::Kind::Message) {
+        message = std::move(directive.text);
+      } else if (directive.kind == WorldDirective::Kind::Item) {
+        items.push_back(ItemDefinition{.name = std::move(directive.text)});
+      } else if (directive.kind == WorldDirective::Kind::Use) {
+        items.back().use_message = std::move(directive.text);
+      }
+    }
+    _file.clear();
+    return Room(name, message, make_items(items), _connections[room]);
+  }
+
+  PagedMap::Resident& PagedMap::load(RoomId room) const {
+    if (const auto resident = _resident.find(room);
+        resident != _resident.end()) {
+      _recency.splice(_recency.begin(), _recency, resident->second.recency);
+      return resident->second;
+    }
+
+    auto loaded = read_room(room);
+    ++_loads;
+    bool changed = false;
+    if (const auto kept = _kept_inventories.find(room);
+        kept != _kept_inventories.end()) {
+      loaded.inventory() = std::move(kept->second);
+      _kept_inventories.erase(kept);
+      changed = true;
+    }
+    const auto bytes = footprint(loaded);
+    _recency.push_front(room);
+    auto& resident =
+        _resident
+            .emplace(room, Resident{.room = std::move(loaded),
+                                    .bytes = bytes,
+                                    .changed = changed,
+                                    .recency = _recency.begin()})
+            .first->second;
+    _resident_bytes += bytes;
+    evict_to_budget(room);
+    return resident;
+  }
+
+  void PagedMap::evict_to_budget(RoomId keep) const {
+    while (_resident_bytes > _budget_bytes && _recency.back() != keep) {
+      const auto victim = _resident.find(_recency.back());
+      if (victim->second.changed) {
+        _kept_inventories.emplace(victim->first,
+                                  std::move(victim->second.room.inventory()));
+      }
+      _resident_bytes -= victim->second.bytes;
+      _resident.erase(victim);
+      _recency.pop_back();
+      ++_evictions;
+    }
+  }
+
+  RoomId PagedMap::id_of(const RoomName& room) const {
+    const auto room_id = find_room(room);
+    if (!room_id.has_value()) {
+      throw std::out_of_range("Unknown room: " + room);
+    }
+    return room_id.value();
+  }
+
+  std::optional<RoomId> PagedMap::find_room(const RoomName& room) const {
+    return find_by_name(room, hash_of(room), true);
+  }
+
+  std::optional<std::string_view> PagedMap::next_room(
+      const RoomName& current_room, Direction direction) {
+    const auto next = next_room(id_of(current_room), direction);
+    if (!next.has_value()) {
+      return std::nullopt;
+    }
+    return get_room_name(next.value());
+  }
+
+  std::optional<RoomId> PagedMap::next_room(RoomId current_room,
+                                            Direction direction) {
+    return _connections[current_room].get_connection(direction);
+  }
+
+  std::string_view PagedMap::get_welcome_message(const RoomName& room) const {
+    return get_welcome_message(id_of(room));
+  }
+
+  std::string_view PagedMap::get_welcome_message(RoomId room) const {
+    return load(room).room.get_message();
+  }
+
+  std::string_view PagedMap::get_room_name(RoomId room) const {
+    return load(room).room.get_name();
+  }
+
+  Room& PagedMap::get_room(const RoomName& room) {
+    return get_room(id_of(room));
+  }
+
+  Room& PagedMap::get_room(RoomId room) {
+    auto& resident = load(room);
+    resident.changed = true;
+    return resident.room;
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,137 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"  // for Direction, DirectionSet
+#include "IMap.hpp"       // for IMap
+#include "Inventory.hpp"  // for Inventory, InventoryItem
+#include "Room.hpp"       // for Room, RoomConnections
+#include "Types.hpp"      // for RoomName, RoomId
+
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint64_t
+#include <filesystem>     // for path
+#include <fstream>        // for ifstream
+#include <list>           // for list
+#include <optional>       // for optional
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+namespace adv_sk {
+
+  /**
+   * @brief IMap over a text world file that keeps only recent rooms resident.
+   *
+   * Construction streams the file once, one line at a time. It records
+   * each room's byte offset, a hash of its name and its resolved exits,
+   * about 50 bytes per room and no text. next_room() and available_exits()
+   * are answered from that index alone. Names, messages and rooms are read
+   * back from the file the first time they are needed and stay resident
+   * until the least recently used ones are evicted to stay within
+   * `budget_bytes`.
+   *
+   * A room handed out by get_room() may have been changed, so its inventory
+   * is kept aside when the room is evicted and restored when it is loaded
+   * again. References and views returned by this map stay valid until the
+   * next call on it.
+   *
+   * Throws std::runtime_error for unreadable or malformed files, and
+   * std::out_of_range for exits to unknown rooms, as parse_world() does.
+   */
+  class PagedMap : public IMap {
+   public:
+    PagedMap(const std::filesystem::path& path, std::size_t budget_bytes);
+
+    [[nodiscard]] std::optional<RoomId> find_room(
+        const RoomName& room) const override;
+
+    std::optional<std::string_view> next_room(const RoomName& current_room,
+                                              Direction direction) override;
+
+    std::optional<RoomId> next_room(RoomId current_room,
+                                    Direction direction) override;
+
+    [[nodiscard]] DirectionSet available_exits(RoomId room) const override {
+      return _connections[room].directions();
+    }
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        const RoomName& room) const override;
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        RoomId room) const override;
+
+    [[nodiscard]] std::string_view get_room_name(RoomId room) const override;
+
+    [[nodiscard]] Room& get_room(const RoomName& room) override;
+
+    [[nodiscard]] Room& get_room(RoomId room) override;
+
+    [[nodiscard]] std::size_t size() const {
+      return _offsets.size();
+    }
+
+    [[nodiscard]] std::size_t resident_rooms() const {
+      return _resident.size();
+    }
+
+    /// Estimated heap and object bytes of the resident rooms.
+    [[nodiscard]] std::size_t resident_bytes() const {
+      return _resident_bytes;
+    }
+
+    /// Rooms read from the file so far, counting reloads after eviction.
+    [[nodiscard]] std::size_t loads() const {
+      return _loads;
+    }
+
+    [[nodiscard]] std::size_t evictions() const {
+      return _evictions;
+    }
+
+   private:
+    struct Resident {
+      Room room;
+      std::size_t bytes;
+      bool changed;
+      std::list<RoomId>::iterator recency;
+    };
+
+    void scan();
+    [[nodiscard]] RoomId id_of(const RoomName& room) const;
+    /// The room with `name`; compares names, reading them back from the
+    /// file, only if `compare` is set and otherwise trusts the hash.
+    [[nodiscard]] std::optional<RoomId> find_by_name(std::string_view name,
+                                                     std::size_t hash,
+                                                     bool compare) const;
+    void index_name(std::size_t hash, RoomId room);
+    [[nodiscard]] std::string read_line(std::uint64_t offset) const;
+    [[nodiscard]] RoomName read_name(RoomId room) const;
+    [[nodiscard]] Room read_room(RoomId room) const;
+    Resident& load(RoomId room) const;
+    void evict_to_budget(RoomId keep) const;
+
+    std::size_t _budget_bytes;
+    mutable std::ifstream _file;
+
+    std::vector<std::uint64_t> _offsets{};
+    std::vector<std::size_t> _name_hashes{};
+    std::vector<RoomId> _name_slots{};
+    /// Hashes shared by rooms of different names; exits to them compare.
+    std::unordered_set<std::size_t> _colliding_hashes{};
+    std::vector<RoomConnections> _connections{};
+
+    mutable std::unordered_map<RoomId, Resident> _resident{};
+    mutable std::list<RoomId> _recency{};
+    mutable std::size_t _resident_bytes{0};
+    mutable std::size_t _loads{0};
+    mutable std::size_t _evictions{0};
+    mutable std::unordered_map<RoomId, Inventory> _kept_inventories{};
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,167 @@
+// PagedMap unit tests
+
+#include "PagedMap.hpp"
+
+#include "Direction.hpp"       // for Direction, ALL_DIRECTIONS
+#include "Inventory.hpp"       // for InventoryItem
+#include "Map.hpp"             // for Map
+#include "Room.hpp"            // for Room
+#include "Types.hpp"           // for RoomId
+#include "WorldGenerator.hpp"  // for generate_map, GeneratorOptions
+#include "WorldText.hpp"       // for write_world_text
+#include "gtest/gtest.h"       // for TEST, EXPECT_EQ
+
+#include <algorithm>    // for equal
+#include <cstddef>      // for size_t
+#include <cstdint>      // for SIZE_MAX
+#include <filesystem>   // for path, temp_directory_path, remove
+#include <fstream>      // for ofstream
+#include <memory>       // for unique_ptr
+#include <stdexcept>    // for runtime_error, out_of_range
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for as_const
+
+namespace adv_sk::test {
+
+  namespace {
+    /// A world file in the temp directory, removed when the test ends.
+    class WorldFile {
+     public:
+      explicit WorldFile(std::string_view text)
+          : _path(std::filesystem::temp_directory_path() /
+                  "adv_sk_paged_map.world") {
+        std::ofstream(_path, std::ios::binary) << text;
+      }
+
+      explicit WorldFile(const Map& map)
+          : _path(std::filesystem::temp_directory_path() /
+                  "adv_sk_paged_map.world") {
+        std::ofstream out(_path, std::ios::binary);
+        write_world_text(map, out);
+      }
+
+      WorldFile(const WorldFile&) = delete;
+      WorldFile& operator=(const WorldFile&) = delete;
+      WorldFile(WorldFile&&) = delete;
+      WorldFile& operator=(WorldFile&&) = delete;
+
+      ~WorldFile() {
+        std::filesystem::remove(_path);
+      }
+
+      [[nodiscard]] const std::filesystem::path& path() const {
+        return _path;
+      }
+
+     private:
+      std::filesystem::path _path;
+    };
+
+    constexpr std::size_t UNLIMITED = SIZE_MAX;
+    constexpr std::size_t SMALL_BUDGET = 4 * 1024;
+
+    std::unique_ptr<Map> make_world() {
+      return generate_map(GeneratorOptions{.topology = Topology::RandomGraph,
+                                           .room_count = 500,
+                                           .item_density = 1.5,
+                                           .seed = 11});
+    }
+  }  // namespace
+
+  TEST(PagedMap, servesSameWorldAsMap) {
+    const auto map = make_world();
+    const WorldFile file(*map);
+    PagedMap paged(file.path(), SMALL_BUDGET);
+
+    ASSERT_EQ(paged.size(), map->size());
+    for (RoomId room = 0; room < map->size(); ++room) {
+      const auto& expected = std::as_const(*map).get_room(room);
+      EXPECT_EQ(paged.find_room(RoomName(expected.get_name())), room);
+      EXPECT_EQ(paged.get_room_name(room), expected.get_name());
+      EXPECT_EQ(paged.get_welcome_message(room), expected.get_message());
+      EXPECT_EQ(paged.available_exits(room),
+                expected.connections().directions());
+      for (const auto direction : ALL_DIRECTIONS) {
+        EXPECT_EQ(paged.next_room(room, direction),
+                  expected.connections().get_connection(direction));
+      }
+      EXPECT_TRUE(std::ranges::equal(paged.get_room(room).inventory(),
+                                     expected.inventory()));
+    }
+    EXPECT_FALSE(paged.find_room("Attic").has_value());
+  }
+
+  TEST(PagedMap, answersExitsWithoutLoadingRooms) {
+    const WorldFile file(*make_world());
+    PagedMap paged(file.path(), UNLIMITED);
+    for (RoomId room = 0; room < paged.size(); ++room) {
+      static_cast<void>(paged.next_room(room, Direction::North));
+      static_cast<void>(paged.available_exits(room));
+    }
+    EXPECT_EQ(paged.loads(), 0);
+    EXPECT_EQ(paged.resident_rooms(), 0);
+  }
+
+  TEST(PagedMap, staysWithinMemoryBudget) {
+    const WorldFile file(*make_world());
+    PagedMap paged(file.path(), SMALL_BUDGET);
+    for (RoomId room = 0; room < paged.size(); ++room) {
+      static_cast<void>(paged.get_welcome_message(room));
+      EXPECT_LE(paged.resident_bytes(), SMALL_BUDGET);
+    }
+    EXPECT_GT(paged.evictions(), 0);
+    EXPECT_LT(paged.resident_rooms(), paged.size());
+  }
+
+  TEST(PagedMap, keepsRecentlyUsedRoomsResident) {
+    const WorldFile file(*make_world());
+    PagedMap paged(file.path(), SMALL_BUDGET);
+    for (RoomId room = 1; room < paged.size(); ++room) {
+      static_cast<void>(paged.get_welcome_message(RoomId{0}));
+      static_cast<void>(paged.get_welcome_message(room));
+    }
+    EXPECT_EQ(paged.loads(), paged.size());
+  }
+
+  TEST(PagedMap, changesSurviveEviction) {
+    const WorldFile file(*make_world());
+    PagedMap paged(file.path(), SMALL_BUDGET);
+    auto& first = paged.get_room(RoomId{0});
+    first.inventory().clear();
+    first.add_to_inventory(InventoryItem("dropped lamp"));
+
+    for (RoomId room = 1; room < paged.size(); ++room) {
+      static_cast<void>(paged.get_welcome_message(room));
+    }
+    const auto loads = paged.loads();
+    const auto& reloaded = paged.get_room(RoomId{0});
+    EXPECT_EQ(paged.loads(), loads + 1);
+    ASSERT_EQ(reloaded.inventory().size(), 1);
+    EXPECT_EQ(reloaded.inventory()[0].name(), "dropped lamp");
+  }
+
+  TEST(PagedMap, firstRoomOfANameWins) {
+    const WorldFile file(
+        "room A\nmessage first\nexit North B\n"
+        "room B\n"
+        "room A\nmessage second\nexit East B\n");
+    PagedMap paged(file.path(), UNLIMITED);
+    EXPECT_EQ(paged.size(), 2);
+    EXPECT_EQ(paged.get_welcome_message("A"), "first");
+    EXPECT_EQ(paged.next_room("A", Direction::North), "B");
+    EXPECT_FALSE(paged.next_room("A", Direction::East).has_value());
+  }
+
+  TEST(PagedMap, reportsMalformedWorlds) {
+    const WorldFile orphan("message Hello\n");
+    EXPECT_THROW(PagedMap(orphan.path(), UNLIMITED), std::runtime_error);
+
+    const WorldFile dangling("room A\nexit North Nowhere\n");
+    EXPECT_THROW(PagedMap(dangling.path(), UNLIMITED), std::out_of_range);
+
+    EXPECT_THROW(PagedMap("/nonexistent/world.world", UNLIMITED),
+                 std::runtime_error);
+  }
+
+}  // namespace adv_sk::test
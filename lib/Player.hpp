@@ -4,40 +4,46 @@
 #pragma once
 
 #include "IPlayer.hpp"    // for IPlayer
-#include "Inventory.hpp"  // for InventoryItem
-#include "Types.hpp"      // for RoomName
+#include "Inventory.hpp"  // for Inventory, InventoryItem
+#include "Types.hpp"      // for RoomId, INVALID_ROOM_ID
 
-#include <string>  // for string
-#include <vector>  // for vector
+#include <memory_resource>  // for polymorphic_allocator
 
 namespace adv_sk {
 
-  class Player : public IPlayer {
+  class Player final : public IPlayer {
    public:
-    [[nodiscard]] const std::vector<InventoryItem>& get_inventory()
-        const override {
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    Player() = default;
+
+    /// A player whose inventory lives in `allocator`'s resource.
+    explicit Player(allocator_type allocator) : _inventory(allocator) {
+    }
+
+    [[nodiscard]] const Inventory& get_inventory() const override {
       return _inventory;
     }
 
-    [[nodiscard]] std::vector<InventoryItem>& get_mutable_inventory() override {
+    [[nodiscard]] Inventory& get_mutable_inventory() override {
       return _inventory;
     }
 
     void add_to_inventory(const InventoryItem& item) override {
-      _inventory.push_back(item);
+      _inventory.add(item);
     }
 
-    [[nodiscard]] RoomName get_current_room() const override {
+    [[nodiscard]] RoomId get_current_room() const override {
       return _current_room;
     }
 
-    void change_room(const RoomName& room) override {
+    void change_room(RoomId room) override {
       _current_room = room;
     }
 
    private:
-    RoomName _current_room{};
-    std::vector<InventoryItem> _inventory{};
+    RoomId _current_room{INVALID_ROOM_ID};
+    Inventory _inventory{};
   };
 
 }  // namespace adv_sk
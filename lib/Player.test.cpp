@@ -3,9 +3,9 @@
 #include "Player.hpp"
 
 #include "Inventory.hpp"  // for InventoryItem
+#include "Types.hpp"      // for RoomId, INVALID_ROOM_ID
 #include "gtest/gtest.h"  // for TEST, EXPECT_EQ
 
-#include <string>  // for string
 #include <vector>  // for vector
 
 namespace adv_sk::test {
@@ -15,27 +15,27 @@ namespace adv_sk::test {
     EXPECT_TRUE(player.get_inventory().empty());
   }
 
-  TEST(Player, initialCurrentRoomIsEmpty) {
+  TEST(Player, initialCurrentRoomIsInvalid) {
     const Player player;
-    EXPECT_EQ(player.get_current_room(), "");
+    EXPECT_EQ(player.get_current_room(), INVALID_ROOM_ID);
   }
 
   TEST(Player, changeRoomUpdatesCurrentRoom) {
     Player player;
-    player.change_room("GrandHall");
-    EXPECT_EQ(player.get_current_room(), "GrandHall");
+    player.change_room(RoomId{0});
+    EXPECT_EQ(player.get_current_room(), RoomId{0});
   }
 
   TEST(Player, addToInventory) {
     Player player;
-    player.add_to_inventory(InventoryItem{.name = "sword"});
+    player.add_to_inventory(InventoryItem("sword"));
     EXPECT_EQ(player.get_inventory().size(), 1);
-    EXPECT_EQ(player.get_inventory()[0].name, "sword");
+    EXPECT_EQ(player.get_inventory()[0].name(), "sword");
   }
 
   TEST(Player, getMutableInventoryAllowsModification) {
     Player player;
-    player.add_to_inventory(InventoryItem{.name = "sword"});
+    player.add_to_inventory(InventoryItem("sword"));
     auto& inventory = player.get_mutable_inventory();
     inventory.clear();
     EXPECT_TRUE(player.get_inventory().empty());
@@ -43,16 +43,16 @@ namespace adv_sk::test {
 
   TEST(Player, addMultipleItems) {
     Player player;
-    player.add_to_inventory(InventoryItem{.name = "sword"});
-    player.add_to_inventory(InventoryItem{.name = "shield"});
+    player.add_to_inventory(InventoryItem("sword"));
+    player.add_to_inventory(InventoryItem("shield"));
     EXPECT_EQ(player.get_inventory().size(), 2);
   }
 
   TEST(Player, changeRoomMultipleTimes) {
     Player player;
-    player.change_room("GrandHall");
-    player.change_room("Armoury");
-    EXPECT_EQ(player.get_current_room(), "Armoury");
+    player.change_room(RoomId{0});
+    player.change_room(RoomId{1});
+    EXPECT_EQ(player.get_current_room(), RoomId{1});
   }
 
 }  // namespace adv_sk::test
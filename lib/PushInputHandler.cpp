@@ -0,0 +1,49 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "PushInputHandler.hpp"
+
+#include <utility>  // for exchange, move
+
+namespace adv_sk {
+
+  void PushInputHandler::push(ScriptStep step) {
+    _pending.push_back(std::move(step));
+    if (_waiting) {
+      std::exchange(_waiting, {}).resume();
+    }
+  }
+
+  const ScriptStep& PushInputHandler::NextStep::await_resume() {
+    _input._current = std::move(_input._pending.front());
+    _input._pending.pop_front();
+    return _input._current;
+  }
+
+  Task<Action> PushInputHandler::get_action() {
+    co_return (co_await NextStep(*this)).action;
+  }
+
+  void PushInputHandler::provide_directions(DirectionSet /*directions*/) {
+  }
+
+  Task<std::optional<Direction>> PushInputHandler::get_direction() {
+    co_return _current.direction;
+  }
+
+  Task<std::string> PushInputHandler::get_item_name() {
+    co_return _current.item_name;
+  }
+
+  Task<std::string> PushInputHandler::get_room_name() {
+    co_return _current.room_name;
+  }
+
+  void PushInputHandler::provide_message(std::string_view message) {
+    if (_transcript != nullptr) {
+      _transcript->append(message).push_back('\n');
+    }
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,78 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "ActionScript.hpp"        // for ScriptStep
+#include "Direction.hpp"           // for Direction, DirectionSet
+#include "IAsyncInputHandler.hpp"  // for IAsyncInputHandler
+#include "IInputHandler.hpp"       // for Action
+#include "Task.hpp"                // for Task
+
+#include <coroutine>    // for coroutine_handle
+#include <deque>        // for deque
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace adv_sk {
+
+  /**
+   * @brief Async input fed from outside, one ScriptStep per player command.
+   *
+   * get_action() suspends the game while no step is queued; push() queues a
+   * step and resumes a waiting game on the caller's thread, which runs until
+   * the game asks for its next action. One thread can thereby serve any
+   * number of idle sessions. Direction, item and room reads answer from the
+   * step being handled. Messages are appended, newline-terminated, to
+   * `transcript` when one is given.
+   */
+  class PushInputHandler : public IAsyncInputHandler {
+   public:
+    explicit PushInputHandler(std::string* transcript = nullptr)
+        : _transcript(transcript) {
+    }
+
+    void push(ScriptStep step);
+
+    /// True while a game is suspended waiting for the next step.
+    [[nodiscard]] bool waiting() const {
+      return static_cast<bool>(_waiting);
+    }
+
+    Task<Action> get_action() override;
+    void provide_directions(DirectionSet directions) override;
+    Task<std::optional<Direction>> get_direction() override;
+    Task<std::string> get_item_name() override;
+    Task<std::string> get_room_name() override;
+    void provide_message(std::string_view message) override;
+
+   private:
+    /// Suspends until a step is queued, then makes it the current step.
+    class NextStep {
+     public:
+      explicit NextStep(PushInputHandler& input) : _input(input) {
+      }
+
+      [[nodiscard]] bool await_ready() const {
+        return !_input._pending.empty();
+      }
+
+      void await_suspend(std::coroutine_handle<> waiting) {
+        _input._waiting = waiting;
+      }
+
+      const ScriptStep& await_resume();
+
+     private:
+      PushInputHandler& _input;
+    };
+
+    std::deque<ScriptStep> _pending{};
+    ScriptStep _current{};
+    std::coroutine_handle<> _waiting{};
+    std::string* _transcript;
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,103 @@
+// PushInputHandler unit tests
+
+#include "PushInputHandler.hpp"
+
+#include "ActionScript.hpp"  // for parse_script, ScriptStep
+#include "Game.hpp"          // for Game
+#include "Map.hpp"           // for create_map
+#include "Player.hpp"        // for Player
+#include "SessionMap.hpp"    // for SessionMap, SharedWorld
+#include "Task.hpp"          // for Task
+#include "gtest/gtest.h"     // for TEST, EXPECT_EQ
+
+#include <cstddef>      // for size_t
+#include <memory>       // for make_unique
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    constexpr auto WELCOME =
+        "You are in the Grand Hall. It is a vast, echoing chamber.\n";
+
+    /// A game driven by a PushInputHandler, suspended at its first read.
+    struct Session {
+      explicit Session(const SharedWorld& world) {
+        auto handler = std::make_unique<PushInputHandler>(&transcript);
+        input = handler.get();
+        game = std::make_unique<Game>(std::make_unique<SessionMap>(world),
+                                      std::make_unique<Player>(),
+                                      std::move(handler));
+        loop = game->run();
+        loop.resume();
+      }
+
+      void push(std::string_view script) {
+        for (auto& step : parse_script(script)) {
+          input->push(std::move(step));
+        }
+      }
+
+      std::string transcript{};
+      PushInputHandler* input{nullptr};
+      std::unique_ptr<Game> game{};
+      Task<> loop{};
+    };
+  }  // namespace
+
+  TEST(PushInputHandler, gameWaitsForInput) {
+    const Session session(create_map());
+    EXPECT_TRUE(session.input->waiting());
+    EXPECT_FALSE(session.loop.done());
+    EXPECT_EQ(session.transcript, WELCOME);
+  }
+
+  TEST(PushInputHandler, pushResumesGameUntilNextRead) {
+    Session session(create_map());
+    session.push("investigate; take golden chalice");
+
+    EXPECT_TRUE(session.input->waiting());
+    EXPECT_EQ(session.transcript,
+              std::string(WELCOME) +
+                  "Investigating GrandHall\n"
+                  "You search the room. You found a golden chalice!\n\n"
+                  "What do you want to take?\n"
+                  "You take the golden chalice\n\n");
+  }
+
+  TEST(PushInputHandler, queuedStepsRunWhenGameStarts) {
+    std::string transcript;
+    auto handler = std::make_unique<PushInputHandler>(&transcript);
+    handler->push(ScriptStep{.action = Action::DisplayInventory});
+    handler->push(ScriptStep{.action = Action::Quit});
+
+    Game game(create_map(), std::make_unique<Player>(), std::move(handler));
+    auto loop = game.run();
+    loop.resume();
+    EXPECT_TRUE(loop.done());
+    EXPECT_EQ(transcript,
+              std::string(WELCOME) + "Your inventory contains:.\n\n");
+  }
+
+  TEST(PushInputHandler, oneThreadMultiplexesManyIdleSessions) {
+    constexpr std::size_t SESSIONS = 1'000;
+    const SharedWorld world = create_map();
+    std::vector<std::unique_ptr<Session>> sessions;
+    for (std::size_t index = 0; index < SESSIONS; ++index) {
+      sessions.push_back(std::make_unique<Session>(world));
+    }
+
+    for (std::size_t index = 0; index < SESSIONS; index += 2) {
+      sessions[index]->push("move North; quit");
+    }
+    for (std::size_t index = 0; index < SESSIONS; ++index) {
+      EXPECT_EQ(sessions[index]->loop.done(), index % 2 == 0);
+      EXPECT_EQ(sessions[index]->game->get_current_location(),
+                index % 2 == 0 ? "Armoury" : "GrandHall");
+    }
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,36 @@
+// Reachability benchmarks
+
+#include "Reachability.hpp"
+
+#include "BenchmarkSupport.hpp"   // for MAX_ROOMS
+#include "WorldGenerator.hpp"     // for generate_map, GeneratorOptions
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>  // for size_t
+
+namespace adv_sk::bench {
+
+  namespace {
+    void BM_AnalyseReachability(benchmark::State& state) {
+      const auto map = generate_map(GeneratorOptions{
+          .topology = static_cast<Topology>(state.range(0)),
+          .room_count = static_cast<std::size_t>(state.range(1))});
+      const ReachabilityOptions options{
+          .threads = static_cast<std::size_t>(state.range(2))};
+      for (auto _ : state) {
+        const auto report = analyse_reachability(*map, options);
+        benchmark::DoNotOptimize(report.eccentricity);
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK(BM_AnalyseReachability)
+        ->ArgsProduct({{static_cast<int>(Topology::Grid),
+                        static_cast<int>(Topology::RandomGraph)},
+                       {100'000, MAX_ROOMS},
+                       {1, 4}})
+        ->ArgNames({"topology", "rooms", "threads"})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,270 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "Reachability.hpp"
+
+#include <algorithm>   // for find_if, max, min
+#include <array>       // for array
+#include <atomic>      // for atomic, memory_order_relaxed
+#include <barrier>     // for barrier
+#include <bit>         // for countr_zero
+#include <cstddef>     // for size_t, ptrdiff_t
+#include <cstdint>     // for uint32_t, uint64_t
+#include <functional>  // for function
+#include <stdexcept>   // for out_of_range
+#include <string>      // for string
+#include <thread>      // for thread, hardware_concurrency
+#include <utility>     // for swap
+#include <vector>      // for vector
+
+namespace adv_sk {
+
+  namespace {
+    using Bitmap = std::vector<std::atomic<std::uint64_t>>;
+
+    constexpr std::size_t WORD_BITS = 64;
+
+    std::size_t worker_count(std::size_t requested, std::size_t work) {
+      if (requested == 0) {
+        requested = std::max(1U, std::thread::hardware_concurrency());
+      }
+      return std::max<std::size_t>(1, std::min(requested, work));
+    }
+
+    /// Runs `work(begin, end)` over equal slices of [0, count).
+    void parallel_for(
+        std::size_t count, std::size_t workers,
+        const std::function<void(std::size_t, std::size_t)>& work) {
+      const auto slice = (count + workers - 1) / workers;
+      std::vector<std::thread> threads;
+      threads.reserve(workers - 1);
+      for (std::size_t worker = 1; worker < workers; ++worker) {
+        threads.emplace_back(work, std::min(count, worker * slice),
+                             std::min(count, (worker + 1) * slice));
+      }
+      work(0, std::min(count, slice));
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    }
+
+    /// Level-synchronous BFS; fills `report.distances` and `eccentricity`.
+    class LevelSearch {
+     public:
+      LevelSearch(std::span<const Room> rooms, ReachabilityReport& report)
+          : _rooms(rooms),
+            _report(report),
+            _words((rooms.size() + WORD_BITS - 1) / WORD_BITS),
+            _visited(_words),
+            _frontiers{Bitmap(_words), Bitmap(_words)} {
+      }
+
+      void run(RoomId start, std::size_t workers) {
+        _report.distances.assign(_rooms.size(), ReachabilityReport::UNREACHED);
+        _report.distances[start] = 0;
+        _report.reachable_rooms = 1;
+        set(_visited, start);
+        set(*_current, start);
+
+        const auto slice = (_words + workers - 1) / workers;
+        std::barrier level_done(static_cast<std::ptrdiff_t>(workers),
+                                [this]() noexcept { next_level(); });
+        const auto work = [&](std::size_t worker) {
+          const auto begin = std::min(_words, worker * slice);
+          const auto end = std::min(_words, (worker + 1) * slice);
+          while (!_finished) {
+            expand(begin, end);
+            level_done.arrive_and_wait();
+          }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (std::size_t worker = 1; worker < workers; ++worker) {
+          threads.emplace_back(work, worker);
+        }
+        work(0);
+        for (auto& thread : threads) {
+          thread.join();
+        }
+      }
+
+     private:
+      static void set(Bitmap& bitmap, RoomId room) {
+        bitmap[room / WORD_BITS].fetch_or(
+            std::uint64_t{1} << (room % WORD_BITS), std::memory_order_relaxed);
+      }
+
+      /// Visits the exits of this worker's frontier words, then clears them
+      /// so the bitmap is empty when it becomes the next frontier again.
+      void expand(std::size_t begin, std::size_t end) {
+        const auto distance = _level + 1;
+        std::size_t discovered = 0;
+        for (auto word = begin; word < end; ++word) {
+          auto bits = (*_current)[word].load(std::memory_order_relaxed);
+          if (bits == 0) {
+            continue;
+          }
+          (*_current)[word].store(0, std::memory_order_relaxed);
+          for (; bits != 0; bits &= bits - 1) {
+            const auto room = static_cast<RoomId>(
+                (word * WORD_BITS) + std::countr_zero(bits));
+            const auto& exits = _rooms[room].connections();
+            for (const auto direction : exits.directions()) {
+              const auto target = exits.target(direction);
+              if (target >= _rooms.size()) {
+                continue;
+              }
+              const auto bit = std::uint64_t{1} << (target % WORD_BITS);
+              const auto before = _visited[target / WORD_BITS].fetch_or(
+                  bit, std::memory_order_relaxed);
+              if ((before & bit) == 0) {
+                // The one worker that set the visited bit owns the room.
+                _report.distances[target] = distance;
+                set(*_next, target);
+                ++discovered;
+              }
+            }
+          }
+        }
+        _discovered.fetch_add(discovered, std::memory_order_relaxed);
+      }
+
+      /// Runs on one worker while the others wait at the barrier.
+      void next_level() {
+        const auto discovered = _discovered.exchange(0);
+        _report.reachable_rooms += discovered;
+        if (discovered == 0) {
+          _finished = true;
+          return;
+        }
+        ++_level;
+        _report.eccentricity = _level;
+        std::swap(_current, _next);
+      }
+
+      std::span<const Room> _rooms;
+      ReachabilityReport& _report;
+      std::size_t _words;
+      Bitmap _visited;
+      std::array<Bitmap, 2> _frontiers;
+      Bitmap* _current{&_frontiers[0]};
+      Bitmap* _next{&_frontiers[1]};
+      std::atomic<std::size_t> _discovered{0};
+      std::uint32_t _level{0};
+      bool _finished{false};
+    };
+
+    /// Lock-free union-find; every root is the lowest RoomId of its set.
+    class Components {
+     public:
+      explicit Components(std::size_t rooms) : _parent(rooms) {
+        for (RoomId room = 0; room < rooms; ++room) {
+          _parent[room].store(room, std::memory_order_relaxed);
+        }
+      }
+
+      RoomId find(RoomId room) {
+        for (;;) {
+          auto parent = _parent[room].load(std::memory_order_relaxed);
+          if (parent == room) {
+            return room;
+          }
+          // Path halving; losing the race only skips a shortcut.
+          const auto grandparent =
+              _parent[parent].load(std::memory_order_relaxed);
+          _parent[room].compare_exchange_weak(parent, grandparent,
+                                              std::memory_order_relaxed);
+          room = grandparent;
+        }
+      }
+
+      void unite(RoomId first, RoomId second) {
+        for (;;) {
+          first = find(first);
+          second = find(second);
+          if (first == second) {
+            return;
+          }
+          if (first > second) {
+            std::swap(first, second);
+          }
+          auto expected = second;
+          if (_parent[second].compare_exchange_strong(
+                  expected, first, std::memory_order_relaxed)) {
+            return;
+          }
+        }
+      }
+
+     private:
+      std::vector<std::atomic<RoomId>> _parent;
+    };
+  }  // namespace
+
+  ReachabilityReport analyse_reachability(
+      std::span<const Room> rooms, const ReachabilityOptions& options) {
+    const auto start = std::find_if(
+        rooms.begin(), rooms.end(), [&options](const Room& room) {
+          return room.get_name() == options.start_room;
+        });
+    if (start == rooms.end()) {
+      throw std::out_of_range("Unknown room: " + options.start_room);
+    }
+
+    ReachabilityReport report;
+    const auto words = (rooms.size() + WORD_BITS - 1) / WORD_BITS;
+    LevelSearch(rooms, report)
+        .run(static_cast<RoomId>(start - rooms.begin()),
+             worker_count(options.threads, words));
+
+    const auto workers = worker_count(options.threads, rooms.size());
+    Components components(rooms.size());
+    std::atomic<std::size_t> reachable_items{0};
+    std::atomic<std::size_t> unreachable_items{0};
+    parallel_for(rooms.size(), workers,
+                 [&](std::size_t begin, std::size_t end) {
+                   std::size_t reached = 0;
+                   std::size_t missed = 0;
+                   for (auto room = begin; room < end; ++room) {
+                     const auto& exits = rooms[room].connections();
+                     for (const auto direction : exits.directions()) {
+                       const auto target = exits.target(direction);
+                       if (target < rooms.size()) {
+                         components.unite(static_cast<RoomId>(room), target);
+                       }
+                     }
+                     if (report.reachable(static_cast<RoomId>(room))) {
+                       reached += rooms[room].inventory().size();
+                     } else {
+                       missed += rooms[room].inventory().size();
+                     }
+                   }
+                   reachable_items.fetch_add(reached);
+                   unreachable_items.fetch_add(missed);
+                 });
+    report.reachable_items = reachable_items.load();
+    report.unreachable_items = unreachable_items.load();
+
+    // Roots only move to lower ids, so a room's root is final once every
+    // union is done.
+    report.components.resize(rooms.size());
+    std::vector<std::size_t> sizes(rooms.size(), 0);
+    for (RoomId room = 0; room < rooms.size(); ++room) {
+      const auto root = components.find(room);
+      report.components[room] = root;
+      if (sizes[root]++ == 0) {
+        ++report.component_count;
+      }
+      report.largest_component =
+          std::max(report.largest_component, sizes[root]);
+    }
+    return report;
+  }
+
+  ReachabilityReport analyse_reachability(
+      const Map& map, const ReachabilityOptions& options) {
+    return analyse_reachability(map.rooms(), options);
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,62 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Map.hpp"    // for Map
+#include "Room.hpp"   // for Room
+#include "Types.hpp"  // for RoomId, RoomName
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <limits>   // for numeric_limits
+#include <span>     // for span
+#include <vector>   // for vector
+
+namespace adv_sk {
+
+  struct ReachabilityOptions {
+    RoomName start_room{"GrandHall"};
+    /// Worker threads; 0 means one per core.
+    std::size_t threads{0};
+  };
+
+  struct ReachabilityReport {
+    static constexpr auto UNREACHED = std::numeric_limits<std::uint32_t>::max();
+
+    /// Steps from the start room, or UNREACHED, indexed by RoomId.
+    std::vector<std::uint32_t> distances{};
+    /// Lowest RoomId of each room's component, exits taken as two-way.
+    std::vector<RoomId> components{};
+    std::size_t component_count{0};
+    std::size_t largest_component{0};
+    std::size_t reachable_rooms{0};
+    /// Steps to the rooms furthest from the start room.
+    std::size_t eccentricity{0};
+    std::size_t reachable_items{0};
+    std::size_t unreachable_items{0};
+
+    [[nodiscard]] bool reachable(RoomId room) const {
+      return distances[room] != UNREACHED;
+    }
+  };
+
+  /**
+   * @brief Reachability, components and item coverage of a RoomId-linked
+   * world, on all cores.
+   *
+   * Room i has RoomId i. Distances come from a level-synchronous breadth-first
+   * search: each level's frontier is a bitmap split between the workers,
+   * which claim rooms through an atomic visited bitmap and meet at a barrier
+   * between levels. Components come from a lock-free union-find over every
+   * exit. Exits leading outside the world are ignored. Throws
+   * std::out_of_range when the start room does not exist.
+   */
+  ReachabilityReport analyse_reachability(
+      std::span<const Room> rooms, const ReachabilityOptions& options = {});
+
+  ReachabilityReport analyse_reachability(
+      const Map& map, const ReachabilityOptions& options = {});
+
+}  // namespace adv_sk
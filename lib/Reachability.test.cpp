@@ -0,0 +1,102 @@
+// Reachability unit tests
+
+#include "Reachability.hpp"
+
+#include "Direction.hpp"       // for Direction
+#include "Inventory.hpp"       // for InventoryItem
+#include "Map.hpp"             // for Map, create_map
+#include "Room.hpp"            // for Room
+#include "Types.hpp"           // for RoomId
+#include "WorldGenerator.hpp"  // for generate_map, GeneratorOptions
+#include "gtest/gtest.h"       // for TEST, EXPECT_EQ
+
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <stdexcept>  // for out_of_range
+#include <vector>     // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    /// Plain single-threaded BFS to check the parallel one against.
+    std::vector<std::uint32_t> sequential_distances(const Map& map) {
+      std::vector<std::uint32_t> distances(map.size(),
+                                           ReachabilityReport::UNREACHED);
+      std::vector<RoomId> queue{0};
+      distances[0] = 0;
+      for (std::size_t head = 0; head < queue.size(); ++head) {
+        const auto& exits = map.get_room(queue[head]).connections();
+        for (const auto direction : exits.directions()) {
+          const auto target = exits.target(direction);
+          if (distances[target] == ReachabilityReport::UNREACHED) {
+            distances[target] = distances[queue[head]] + 1;
+            queue.push_back(target);
+          }
+        }
+      }
+      return distances;
+    }
+  }  // namespace
+
+  TEST(Reachability, startingMapIsFullyReachable) {
+    const auto report = analyse_reachability(*create_map());
+    EXPECT_EQ(report.reachable_rooms, 2);
+    EXPECT_EQ(report.eccentricity, 1);
+    EXPECT_EQ(report.component_count, 1);
+    EXPECT_EQ(report.reachable_items, 2);
+    EXPECT_EQ(report.unreachable_items, 0);
+  }
+
+  TEST(Reachability, matchesSequentialSearchOnEveryThreadCount) {
+    for (const auto topology : {Topology::Grid, Topology::Maze,
+                                Topology::RandomGraph, Topology::HubAndSpoke}) {
+      const auto map = generate_map(
+          GeneratorOptions{.topology = topology, .room_count = 5'000});
+      const auto expected = sequential_distances(*map);
+      for (const std::size_t threads : {1, 3, 8}) {
+        const auto report = analyse_reachability(
+            *map, ReachabilityOptions{.threads = threads});
+        EXPECT_EQ(report.distances, expected);
+        EXPECT_EQ(report.reachable_rooms, 5'000);
+        EXPECT_EQ(report.component_count, 1);
+        EXPECT_EQ(report.largest_component, 5'000);
+      }
+    }
+  }
+
+  TEST(Reachability, reportsComponentsAndUnreachableItems) {
+    // GrandHall - Armoury, a one-way Slide into the hall, and a lone Vault.
+    std::vector<Room> rooms{
+        Room("GrandHall", "", {InventoryItem("chalice")}),
+        Room("Armoury", "", {InventoryItem("sword")}),
+        Room("Slide", "", {InventoryItem("rope")}),
+        Room("Vault", "",
+             {InventoryItem("gold"), InventoryItem("gem")})};
+    rooms[0].add_connection(Direction::North, 1);
+    rooms[1].add_connection(Direction::South, 0);
+    rooms[2].add_connection(Direction::East, 0);
+    const Map map(std::move(rooms));
+
+    const auto report =
+        analyse_reachability(map, ReachabilityOptions{.threads = 2});
+    EXPECT_EQ(report.reachable_rooms, 2);
+    EXPECT_FALSE(report.reachable(2));
+    EXPECT_EQ(report.reachable_items, 2);
+    EXPECT_EQ(report.unreachable_items, 3);
+    // The slide only leads in, but still joins the hall's component.
+    EXPECT_EQ(report.component_count, 2);
+    EXPECT_EQ(report.largest_component, 3);
+    EXPECT_EQ(report.components, (std::vector<RoomId>{0, 0, 0, 3}));
+  }
+
+  TEST(Reachability, startsFromTheNamedRoom) {
+    const auto map = create_map();
+    const auto report = analyse_reachability(
+        *map, ReachabilityOptions{.start_room = "Armoury"});
+    EXPECT_EQ(report.distances, (std::vector<std::uint32_t>{1, 0}));
+    EXPECT_THROW(static_cast<void>(analyse_reachability(
+                     *map, ReachabilityOptions{.start_room = "Attic"})),
+                 std::out_of_range);
+  }
+
+}  // namespace adv_sk::test
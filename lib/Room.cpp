@@ -2,15 +2,13 @@
 
 namespace adv_sk {
 
-  enum class Direction : std::uint8_t;
-
-  std::optional<RoomName> RoomConnections::get_connection(
+  std::optional<RoomId> RoomConnections::get_connection(
       Direction direction) const {
-    const auto connection = connections.find(direction);
-    if (connection == connections.end()) {
+    const auto room = target(direction);
+    if (room == INVALID_ROOM_ID) {
       return std::nullopt;
     }
-    return connection->second;
+    return room;
   }
 
 }  // namespace adv_sk
@@ -1,73 +1,138 @@
 #pragma once
 
+#include "Direction.hpp"  // for Direction, DirectionSet, DIRECTION_COUNT
 #include "Inventory.hpp"
-#include "Types.hpp"  // for RoomName
+#include "Types.hpp"  // for RoomName, RoomId, INVALID_ROOM_ID
 
-#include <cstdint>  // for uint8_t
+#include <array>
+#include <bit>      // for popcount
+#include <cstddef>  // for size_t
+#include <memory_resource>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace adv_sk {
 
-  enum class Direction : std::uint8_t;
+  /// Exits of a room by target room name, as authored in world content.
+  using NamedConnections = std::unordered_map<Direction, RoomName>;
 
+  /**
+   * @brief Exits of a room as a fixed table indexed by Direction.
+   *
+   * Each slot holds the target RoomId, or INVALID_ROOM_ID when there is no
+   * exit that way; `exits` has the bit of every existing exit set. The table
+   * grows with DIRECTION_COUNT, so new directions need no change here.
+   */
   struct RoomConnections {
-    void add(Direction direction, const RoomName& room) {
-      connections.emplace(direction, room);
+    using Targets = std::array<RoomId, DIRECTION_COUNT>;
+
+    /// Adds an exit unless one already leads in that direction.
+    void add(Direction direction, RoomId room) {
+      if (!contains(direction)) {
+        targets[direction_index(direction)] = room;
+        exits |= direction_bit(direction);
+      }
     }
 
-    [[nodiscard]] std::optional<RoomName> get_connection(
+    [[nodiscard]] bool contains(Direction direction) const {
+      return (exits & direction_bit(direction)) != 0;
+    }
+
+    /// Target of the exit, or INVALID_ROOM_ID when there is none.
+    [[nodiscard]] RoomId target(Direction direction) const {
+      return targets[direction_index(direction)];
+    }
+
+    [[nodiscard]] std::optional<RoomId> get_connection(
         Direction direction) const;
 
-    std::unordered_map<Direction, RoomName> connections{};
+    [[nodiscard]] DirectionSet directions() const {
+      return DirectionSet{exits};
+    }
+
+    [[nodiscard]] std::size_t size() const {
+      return static_cast<std::size_t>(std::popcount(exits));
+    }
+
+    Targets targets{[] {
+      Targets no_exits{};
+      no_exits.fill(INVALID_ROOM_ID);
+      return no_exits;
+    }()};
+    DirectionMask exits{};
   };
 
+  static_assert(sizeof(RoomConnections) <= 64,
+                "a room's adjacency should fit in one cache line");
+
   class Room {
    public:
-    explicit Room(RoomName _name, std::string _message = {},
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    explicit Room(std::string_view _name, std::string_view _message = {},
                   std::vector<InventoryItem> _inventory = {},
                   RoomConnections _connections = {})
-        : _name(std::move(_name)),
-          _message(std::move(_message)),
+        : _name(_name),
+          _message(_message),
           _inventory(std::move(_inventory)),
           _connections(std::move(_connections)) {
     }
 
-    [[nodiscard]] std::string get_message() const {
+    /// A copy whose text and inventory live in `allocator`'s resource.
+    Room(const Room& other, allocator_type allocator)
+        : _name(other._name, allocator),
+          _message(other._message, allocator),
+          _inventory(other._inventory, allocator),
+          _connections(other._connections) {
+    }
+
+    Room(const Room&) = default;
+    Room(Room&&) = default;
+    Room& operator=(const Room&) = default;
+    Room& operator=(Room&&) = default;
+    ~Room() = default;
+
+    [[nodiscard]] std::string_view get_message() const {
       return _message;
     }
 
-    [[nodiscard]] std::string get_name() const {
+    [[nodiscard]] std::string_view get_name() const {
       return _name;
     }
 
-    void add_connection(Direction direction, const RoomName& room) {
+    void add_connection(Direction direction, RoomId room) {
       _connections.add(direction, room);
     }
 
-    [[nodiscard]] RoomConnections connections() const {
+    [[nodiscard]] const RoomConnections& connections() const {
       return _connections;
     }
 
-    [[nodiscard]] std::vector<InventoryItem>& inventory() {
+    [[nodiscard]] Inventory& inventory() {
+      return _inventory;
+    }
+
+    [[nodiscard]] const Inventory& inventory() const {
       return _inventory;
     }
 
-    void add_to_inventory(const InventoryItem& item) {
-      _inventory.push_back(item);
+    void add_to_inventory(const InventoryItem& item, bool visible = false) {
+      _inventory.add(item, visible);
     }
 
     void remove_from_inventory(const InventoryItem& item) {
-      std::erase(_inventory, item);
+      _inventory.erase(item);
     }
 
    private:
-    RoomName _name;
-    std::string _message{};
-    std::vector<InventoryItem> _inventory{};
+    std::pmr::string _name;
+    std::pmr::string _message{};
+    Inventory _inventory{};
 
     RoomConnections _connections{};
   };
@@ -2,49 +2,74 @@
 
 #include "Room.hpp"
 
-#include "Direction.hpp"  // for Direction
+#include "Direction.hpp"  // for Direction, direction_bit
 #include "Inventory.hpp"  // for InventoryItem
+#include "Types.hpp"      // for RoomId, INVALID_ROOM_ID
 #include "gtest/gtest.h"  // for TEST, EXPECT_EQ
 
-#include <optional>       // for optional
-#include <string>         // for string
-#include <unordered_map>  // for unordered_map
-#include <vector>         // for vector
+#include <optional>  // for optional
+#include <string>    // for string
+#include <vector>    // for vector
 
 namespace adv_sk::test {
 
   // --- RoomConnections tests ---
 
+  namespace {
+    constexpr RoomId GRAND_HALL = 0;
+    constexpr RoomId ARMOURY = 1;
+  }  // namespace
+
   TEST(RoomConnections, addAndGetConnection) {
     RoomConnections connections;
-    connections.add(Direction::North, "Armoury");
+    connections.add(Direction::North, ARMOURY);
     auto result = connections.get_connection(Direction::North);
     ASSERT_TRUE(result.has_value());
     // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    EXPECT_EQ(result.value(), "Armoury");
+    EXPECT_EQ(result.value(), ARMOURY);
   }
 
   TEST(RoomConnections, getConnectionReturnsNulloptForMissing) {
     const RoomConnections connections;
     auto result = connections.get_connection(Direction::North);
     EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(connections.target(Direction::North), INVALID_ROOM_ID);
   }
 
   TEST(RoomConnections, addMultipleConnections) {
     RoomConnections connections;
-    connections.add(Direction::North, "Armoury");
-    connections.add(Direction::South, "GrandHall");
+    connections.add(Direction::North, ARMOURY);
+    connections.add(Direction::South, GRAND_HALL);
     auto north = connections.get_connection(Direction::North);
     ASSERT_TRUE(north.has_value());
     // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    EXPECT_EQ(north.value(), "Armoury");
+    EXPECT_EQ(north.value(), ARMOURY);
     auto south = connections.get_connection(Direction::South);
     ASSERT_TRUE(south.has_value());
     // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    EXPECT_EQ(south.value(), "GrandHall");
+    EXPECT_EQ(south.value(), GRAND_HALL);
     EXPECT_FALSE(connections.get_connection(Direction::East).has_value());
   }
 
+  TEST(RoomConnections, exitMaskTracksExistingExits) {
+    RoomConnections connections;
+    EXPECT_EQ(connections.size(), 0);
+    connections.add(Direction::East, ARMOURY);
+    connections.add(Direction::West, GRAND_HALL);
+    EXPECT_EQ(connections.exits, direction_bit(Direction::East) |
+                                     direction_bit(Direction::West));
+    EXPECT_TRUE(connections.contains(Direction::East));
+    EXPECT_FALSE(connections.contains(Direction::North));
+    EXPECT_EQ(connections.size(), 2);
+  }
+
+  TEST(RoomConnections, firstExitInADirectionWins) {
+    RoomConnections connections;
+    connections.add(Direction::North, ARMOURY);
+    connections.add(Direction::North, GRAND_HALL);
+    EXPECT_EQ(connections.target(Direction::North), ARMOURY);
+  }
+
   // --- Room tests ---
 
   TEST(Room, constructorSetsNameAndMessage) {
@@ -59,22 +84,23 @@ namespace adv_sk::test {
   }
 
   TEST(Room, inventoryAccessIsMutable) {
-    Room room("R", "", {InventoryItem{.name = "sword"}});
+    Room room("R", "", {InventoryItem("sword")});
     EXPECT_EQ(room.inventory().size(), 1);
-    room.inventory()[0].is_visible = true;
-    EXPECT_TRUE(room.inventory()[0].is_visible);
+    EXPECT_FALSE(room.inventory().is_visible(0));
+    room.inventory().reveal_all();
+    EXPECT_TRUE(room.inventory().is_visible(0));
   }
 
   TEST(Room, addToInventory) {
     Room room("R");
     EXPECT_TRUE(room.inventory().empty());
-    room.add_to_inventory(InventoryItem{.name = "shield"});
+    room.add_to_inventory(InventoryItem("shield"));
     EXPECT_EQ(room.inventory().size(), 1);
-    EXPECT_EQ(room.inventory()[0].name, "shield");
+    EXPECT_EQ(room.inventory()[0].name(), "shield");
   }
 
   TEST(Room, removeFromInventory) {
-    const InventoryItem sword{.name = "sword"};
+    const InventoryItem sword("sword");
     Room room("R", "", {sword});
     EXPECT_EQ(room.inventory().size(), 1);
     room.remove_from_inventory(sword);
@@ -83,31 +109,36 @@ namespace adv_sk::test {
 
   TEST(Room, addConnectionAndRetrieve) {
     Room room("R");
-    room.add_connection(Direction::North, "Armoury");
-    auto conns = room.connections();
+    room.add_connection(Direction::North, ARMOURY);
+    const auto& conns = room.connections();
     auto result = conns.get_connection(Direction::North);
     ASSERT_TRUE(result.has_value());
     // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    EXPECT_EQ(result.value(), "Armoury");
+    EXPECT_EQ(result.value(), ARMOURY);
   }
 
-  TEST(Room, connectionsReturnsCopy) {
+  TEST(Room, connectionsReturnsReference) {
     Room room("R");
-    room.add_connection(Direction::North, "Armoury");
-    auto conns = room.connections();
-    EXPECT_EQ(conns.connections.size(), 1);
+    room.add_connection(Direction::North, ARMOURY);
+    const auto& conns = room.connections();
+    EXPECT_EQ(conns.size(), 1);
+    EXPECT_EQ(&conns, &room.connections());
+  }
+
+  TEST(Room, constInventoryIsViewOfItems) {
+    const Room room("R", "", {InventoryItem("sword")});
+    const auto items = room.inventory();
+    ASSERT_EQ(items.size(), 1);
+    EXPECT_EQ(items[0].name(), "sword");
   }
 
   TEST(Room, constructorWithInventory) {
-    const InventoryItem sword{
-        .name = "sword", .use_message = "A rusty sword.", .is_visible = false};
-    const InventoryItem shield{.name = "shield",
-                               .use_message = "A wooden shield.",
-                               .is_visible = false};
+    const InventoryItem sword("sword", "A rusty sword.");
+    const InventoryItem shield("shield", "A wooden shield.");
     Room room("R", "msg", {sword, shield});
     EXPECT_EQ(room.inventory().size(), 2);
-    EXPECT_EQ(room.inventory()[0].name, "sword");
-    EXPECT_EQ(room.inventory()[1].name, "shield");
+    EXPECT_EQ(room.inventory()[0].name(), "sword");
+    EXPECT_EQ(room.inventory()[1].name(), "shield");
   }
 
 }  // namespace adv_sk::test
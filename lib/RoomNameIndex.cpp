@@ -0,0 +1,92 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "RoomNameIndex.hpp"
+
+#include "Types.hpp"  // for INVALID_ROOM_ID
+
+#include <bit>          // for bit_ceil
+#include <cstddef>      // for size_t
+#include <functional>   // for hash
+#include <optional>     // for optional, nullopt
+#include <string_view>  // for string_view
+#include <utility>      // for swap
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  namespace {
+    constexpr std::size_t MIN_SLOTS = 16;
+
+    /// Keeps the load factor at or below one half.
+    std::size_t slots_for(std::size_t room_count) {
+      return std::bit_ceil(room_count * 2 < MIN_SLOTS ? MIN_SLOTS
+                                                      : room_count * 2);
+    }
+  }  // namespace
+
+  RoomNameIndex::RoomNameIndex(std::size_t room_count)
+      : _slots(slots_for(room_count), EMPTY) {
+  }
+
+  bool RoomNameIndex::insert(std::string_view name, RoomId room,
+                             const std::vector<Room>& rooms) {
+    if ((_size + 1) * 2 > _slots.size()) {
+      grow();
+    }
+    const auto hash = hash_of(name);
+    auto& slot = _slots[slot_of(name, hash, rooms)];
+    if (slot.room != INVALID_ROOM_ID) {
+      return false;
+    }
+    slot = {.room = room, .hash = hash};
+    ++_size;
+    return true;
+  }
+
+  std::optional<RoomId> RoomNameIndex::find(
+      std::string_view name, const std::vector<Room>& rooms) const {
+    if (_slots.empty()) {
+      return std::nullopt;
+    }
+    const auto room = _slots[slot_of(name, hash_of(name), rooms)].room;
+    if (room == INVALID_ROOM_ID) {
+      return std::nullopt;
+    }
+    return room;
+  }
+
+  std::uint32_t RoomNameIndex::hash_of(std::string_view name) {
+    return static_cast<std::uint32_t>(std::hash<std::string_view>{}(name));
+  }
+
+  std::size_t RoomNameIndex::slot_of(std::string_view name,
+                                     std::uint32_t hash,
+                                     const std::vector<Room>& rooms) const {
+    const auto mask = _slots.size() - 1;
+    auto slot = hash & mask;
+    while (_slots[slot].room != INVALID_ROOM_ID &&
+           (_slots[slot].hash != hash ||
+            rooms[_slots[slot].room].get_name() != name)) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  void RoomNameIndex::grow() {
+    std::vector<Slot> old_slots(slots_for(_size + 1), EMPTY);
+    std::swap(_slots, old_slots);
+    const auto mask = _slots.size() - 1;
+    for (const auto& entry : old_slots) {
+      if (entry.room != INVALID_ROOM_ID) {
+        auto slot = entry.hash & mask;
+        while (_slots[slot].room != INVALID_ROOM_ID) {
+          slot = (slot + 1) & mask;
+        }
+        _slots[slot] = entry;
+      }
+    }
+  }
+
+}  // namespace adv_sk
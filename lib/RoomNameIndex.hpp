@@ -0,0 +1,65 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Room.hpp"   // for Room
+#include "Types.hpp"  // for RoomId, INVALID_ROOM_ID
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <optional>     // for optional
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  /**
+   * @brief Open-addressing index from room name to RoomId.
+   *
+   * Slots hold a RoomId and the low half of its name's hash; names are
+   * compared against the rooms the ids point into, and only where the hash
+   * matches, so the index neither copies names nor allocates per room and
+   * probing past other names never touches their rooms. Every call takes
+   * the room vector the stored ids refer to.
+   */
+  class RoomNameIndex {
+   public:
+    RoomNameIndex() = default;
+
+    /// Sizes the table for `room_count` rooms so inserting them never grows it.
+    explicit RoomNameIndex(std::size_t room_count);
+
+    /// Indexes `room` under `name`; returns false if the name is taken.
+    bool insert(std::string_view name, RoomId room,
+                const std::vector<Room>& rooms);
+
+    [[nodiscard]] std::optional<RoomId> find(
+        std::string_view name, const std::vector<Room>& rooms) const;
+
+    [[nodiscard]] std::size_t size() const {
+      return _size;
+    }
+
+   private:
+    struct Slot {
+      RoomId room;
+      std::uint32_t hash;
+    };
+
+    static constexpr Slot EMPTY{.room = INVALID_ROOM_ID, .hash = 0};
+
+    [[nodiscard]] static std::uint32_t hash_of(std::string_view name);
+
+    [[nodiscard]] std::size_t slot_of(std::string_view name,
+                                      std::uint32_t hash,
+                                      const std::vector<Room>& rooms) const;
+
+    void grow();
+
+    std::vector<Slot> _slots{};
+    std::size_t _size{0};
+  };
+
+}  // namespace adv_sk
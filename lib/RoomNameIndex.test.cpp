@@ -0,0 +1,55 @@
+// RoomNameIndex unit tests
+
+#include "RoomNameIndex.hpp"
+
+#include "Room.hpp"       // for Room
+#include "Types.hpp"      // for RoomId
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <optional>  // for optional
+#include <string>    // for string, to_string
+#include <vector>    // for vector
+
+namespace adv_sk::test {
+
+  TEST(RoomNameIndex, emptyIndexFindsNothing) {
+    const RoomNameIndex index;
+    const std::vector<Room> rooms;
+    EXPECT_FALSE(index.find("GrandHall", rooms).has_value());
+  }
+
+  TEST(RoomNameIndex, findsInsertedRooms) {
+    const std::vector<Room> rooms{Room("GrandHall"), Room("Armoury")};
+    RoomNameIndex index(rooms.size());
+    EXPECT_TRUE(index.insert("GrandHall", 0, rooms));
+    EXPECT_TRUE(index.insert("Armoury", 1, rooms));
+    EXPECT_EQ(index.find("GrandHall", rooms), std::optional<RoomId>(0));
+    EXPECT_EQ(index.find("Armoury", rooms), std::optional<RoomId>(1));
+    EXPECT_FALSE(index.find("Dungeon", rooms).has_value());
+    EXPECT_EQ(index.size(), 2);
+  }
+
+  TEST(RoomNameIndex, rejectsDuplicateName) {
+    const std::vector<Room> rooms{Room("Hall"), Room("Hall")};
+    RoomNameIndex index;
+    EXPECT_TRUE(index.insert("Hall", 0, rooms));
+    EXPECT_FALSE(index.insert("Hall", 1, rooms));
+    EXPECT_EQ(index.find("Hall", rooms), std::optional<RoomId>(0));
+  }
+
+  TEST(RoomNameIndex, growsPastInitialCapacity) {
+    std::vector<Room> rooms;
+    for (int room = 0; room < 1000; ++room) {
+      rooms.emplace_back("Room" + std::to_string(room));
+    }
+    RoomNameIndex index;
+    for (RoomId room = 0; room < rooms.size(); ++room) {
+      ASSERT_TRUE(index.insert(rooms[room].get_name(), room, rooms));
+    }
+    for (RoomId room = 0; room < rooms.size(); ++room) {
+      EXPECT_EQ(index.find(rooms[room].get_name(), rooms),
+                std::optional<RoomId>(room));
+    }
+  }
+
+}  // namespace adv_sk::test
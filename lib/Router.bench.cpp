@@ -0,0 +1,68 @@
+// Router benchmarks
+
+#include "Router.hpp"
+
+#include "BenchmarkSupport.hpp"   // for MAX_ROOMS
+#include "Map.hpp"                // for Map
+#include "Types.hpp"              // for RoomId
+#include "WorldGenerator.hpp"     // for generate_map, GeneratorOptions
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <memory>   // for unique_ptr
+
+namespace adv_sk::bench {
+
+  namespace {
+    std::unique_ptr<Map> make_world(const benchmark::State& state) {
+      return generate_map(GeneratorOptions{
+          .topology = static_cast<Topology>(state.range(0)),
+          .room_count = static_cast<std::size_t>(state.range(1)),
+          .item_density = 0.0});
+    }
+
+    void BM_BuildRouter(benchmark::State& state) {
+      const auto map = make_world(state);
+      for (auto _ : state) {
+        const Router router(*map);
+        benchmark::DoNotOptimize(router.size());
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK(BM_BuildRouter)
+        ->ArgsProduct({{static_cast<int>(Topology::Grid),
+                        static_cast<int>(Topology::RandomGraph)},
+                       {1'000, 100'000, MAX_ROOMS}})
+        ->ArgNames({"topology", "rooms"})
+        ->Unit(benchmark::kMillisecond);
+
+    /// Routes between pseudo-random room pairs; one item is one query.
+    void BM_RouteQuery(benchmark::State& state) {
+      const auto map = make_world(state);
+      const Router router(*map);
+      const auto rooms = static_cast<std::uint64_t>(map->size());
+      std::uint64_t seed = 1;
+      std::size_t steps = 0;
+      for (auto _ : state) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const auto from = static_cast<RoomId>((seed >> 33U) % rooms);
+        const auto to = static_cast<RoomId>((seed >> 13U) % rooms);
+        const auto route = router.route(from, to);
+        steps += route.has_value() ? route->size() : 0;
+        benchmark::DoNotOptimize(route);
+      }
+      state.SetItemsProcessed(state.iterations());
+      state.counters["steps"] = benchmark::Counter(
+          static_cast<double>(steps), benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK(BM_RouteQuery)
+        ->ArgsProduct({{static_cast<int>(Topology::Grid),
+                        static_cast<int>(Topology::Maze),
+                        static_cast<int>(Topology::RandomGraph)},
+                       {1'000, 100'000, MAX_ROOMS}})
+        ->ArgNames({"topology", "rooms"})
+        ->Unit(benchmark::kMicrosecond);
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,346 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "Router.hpp"
+
+#include "Direction.hpp"  // for ALL_DIRECTIONS, direction_index, ...
+
+#include <algorithm>      // for max, min, reverse
+#include <array>          // for array
+#include <cstdint>        // for int64_t, uint32_t
+#include <limits>         // for numeric_limits
+#include <queue>          // for priority_queue
+#include <stdexcept>      // for out_of_range
+#include <string>         // for to_string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+
+namespace adv_sk {
+
+  namespace {
+    constexpr auto UNREACHABLE = std::numeric_limits<std::uint32_t>::max();
+    constexpr std::uint8_t NO_HOP = 0xFF;
+
+    /// Breadth-first step counts from `start`; UNREACHABLE where none.
+    std::vector<std::uint32_t> distances_from(
+        const std::vector<RoomConnections>& exits, RoomId start) {
+      std::vector<std::uint32_t> distances(exits.size(), UNREACHABLE);
+      std::vector<RoomId> queue;
+      queue.reserve(exits.size());
+      queue.push_back(start);
+      distances[start] = 0;
+      for (std::size_t head = 0; head < queue.size(); ++head) {
+        const auto room = queue[head];
+        for (const auto direction : exits[room].directions()) {
+          const auto target = exits[room].target(direction);
+          if (distances[target] == UNREACHABLE) {
+            distances[target] = distances[room] + 1;
+            queue.push_back(target);
+          }
+        }
+      }
+      return distances;
+    }
+
+    /// The reached room furthest from everything in `nearest`.
+    std::optional<RoomId> furthest(const std::vector<std::uint32_t>& nearest) {
+      std::optional<RoomId> result;
+      std::uint32_t best = 0;
+      for (RoomId room = 0; room < nearest.size(); ++room) {
+        if (nearest[room] != UNREACHABLE && nearest[room] > best) {
+          best = nearest[room];
+          result = room;
+        }
+      }
+      return result;
+    }
+
+    struct Visit {
+      std::uint32_t steps;
+      RoomId parent;
+      Direction via;
+    };
+
+    /// Search priority; signed, since balanced potentials can be negative.
+    using Key = std::int64_t;
+
+    struct Candidate {
+      Key key;
+      std::uint32_t steps;
+      RoomId room;
+
+      /// Lowest key first; on ties the deeper room, nearer the goal.
+      bool operator<(const Candidate& other) const {
+        return key != other.key ? key > other.key : steps < other.steps;
+      }
+    };
+
+    /// One direction of the A* search.
+    struct Frontier {
+      std::unordered_map<RoomId, Visit> visits{};
+      std::priority_queue<Candidate> open{};
+    };
+
+    void require_room(RoomId room, std::size_t size) {
+      if (room >= size) {
+        throw std::out_of_range("No room with id " + std::to_string(room));
+      }
+    }
+  }  // namespace
+
+  Router::Router(std::span<const Room> rooms, const RouterOptions& options) {
+    _exits.reserve(rooms.size());
+    for (const auto& room : rooms) {
+      RoomConnections exits;
+      for (const auto direction : room.connections().directions()) {
+        const auto target = room.connections().target(direction);
+        if (target < rooms.size()) {
+          exits.add(direction, target);
+        }
+      }
+      _exits.push_back(exits);
+    }
+    for (RoomId room = 0; room < _exits.size() && _reciprocal; ++room) {
+      for (const auto direction : _exits[room].directions()) {
+        const auto target = _exits[room].target(direction);
+        if (_exits[target].target(opposite_direction(direction)) != room) {
+          _reciprocal = false;
+          break;
+        }
+      }
+    }
+
+    if (_exits.size() <= options.next_hop_limit) {
+      build_next_hops();
+    } else if (!_exits.empty()) {
+      build_landmarks(options.landmarks);
+    }
+  }
+
+  void Router::build_next_hops() {
+    const auto rooms = _exits.size();
+    _next_hops.assign(rooms * rooms, NO_HOP);
+    std::vector<RoomId> queue;
+    queue.reserve(rooms);
+    for (RoomId from = 0; from < rooms; ++from) {
+      // Each room reached inherits the first step of the room it came from.
+      auto* first_step = &_next_hops[from * rooms];
+      queue.clear();
+      queue.push_back(from);
+      for (std::size_t head = 0; head < queue.size(); ++head) {
+        const auto room = queue[head];
+        for (const auto direction : _exits[room].directions()) {
+          const auto target = _exits[room].target(direction);
+          if (target != from && first_step[target] == NO_HOP) {
+            first_step[target] =
+                room == from
+                    ? static_cast<std::uint8_t>(direction_index(direction))
+                    : first_step[room];
+            queue.push_back(target);
+          }
+        }
+      }
+    }
+  }
+
+  void Router::build_landmarks(std::size_t count) {
+    // Farthest-point picks spread the landmarks over the world, which keeps
+    // the bounds tight wherever the query is.
+    auto nearest = distances_from(_exits, 0);
+    _landmark_distances.reserve(count * _exits.size());
+    for (; _landmarks < count; ++_landmarks) {
+      const auto landmark = furthest(nearest);
+      if (!landmark.has_value()) {
+        break;
+      }
+      const auto distances = distances_from(_exits, landmark.value());
+      _landmark_distances.insert(_landmark_distances.end(), distances.begin(),
+                                 distances.end());
+      for (RoomId room = 0; room < _exits.size(); ++room) {
+        nearest[room] = std::min(nearest[room], distances[room]);
+      }
+    }
+  }
+
+  std::optional<Route> Router::route(RoomId from, RoomId to) const {
+    require_room(from, size());
+    require_room(to, size());
+    if (from == to) {
+      return Route{};
+    }
+    return has_next_hop_table() ? follow_next_hops(from, to)
+                                : search(from, to);
+  }
+
+  std::optional<Route> Router::follow_next_hops(RoomId from,
+                                                RoomId to) const {
+    Route route;
+    for (auto room = from; room != to;) {
+      const auto hop = _next_hops[(room * size()) + to];
+      if (hop == NO_HOP) {
+        return std::nullopt;
+      }
+      route.push_back(ALL_DIRECTIONS[hop]);
+      room = _exits[room].target(ALL_DIRECTIONS[hop]);
+    }
+    return route;
+  }
+
+  std::uint32_t Router::lower_bound(RoomId room, RoomId to) const {
+    std::uint32_t bound = 0;
+    for (std::size_t landmark = 0; landmark < _landmarks; ++landmark) {
+      const auto* distances = &_landmark_distances[landmark * size()];
+      const auto at_room = distances[room];
+      const auto at_target = distances[to];
+      if (at_room == UNREACHABLE || at_target == UNREACHABLE) {
+        // With two-way exits, one reached and one not means two separate
+        // parts of the world.
+        if (_reciprocal && at_room != at_target) {
+          return UNREACHABLE;
+        }
+        continue;
+      }
+      // d(landmark, to) <= d(landmark, room) + d(room, to), and the mirror
+      // image when every exit leads back.
+      if (at_target > at_room) {
+        bound = std::max(bound, at_target - at_room);
+      } else if (_reciprocal) {
+        bound = std::max(bound, at_room - at_target);
+      }
+    }
+    return bound;
+  }
+
+  std::optional<Route> Router::search(RoomId from, RoomId to) const {
+    if (lower_bound(from, to) == UNREACHABLE) {
+      return std::nullopt;
+    }
+    // A one-way world searches forward only, keyed by steps + bound. With
+    // two-way exits a backward search from `to` runs as well, and both use
+    // balanced potentials (bound to the goal minus bound to the start,
+    // halved and then doubled to stay integral) so that, as in a
+    // bidirectional breadth-first search, the sum of the two smallest keys
+    // tells when no shorter route is left.
+    const auto key = [this, from, to](bool backward, std::uint32_t steps,
+                                      RoomId room) -> std::optional<Key> {
+      const auto ahead = lower_bound(room, backward ? from : to);
+      if (ahead == UNREACHABLE) {
+        return std::nullopt;
+      }
+      if (!_reciprocal) {
+        return Key{steps} + ahead;
+      }
+      const auto behind = lower_bound(room, backward ? to : from);
+      return (2 * Key{steps}) + ahead - behind;
+    };
+    std::array<Frontier, 2> sides{};
+    sides[0].visits.emplace(from, Visit{0, INVALID_ROOM_ID, Direction::North});
+    sides[0].open.push(Candidate{key(false, 0, from).value(), 0, from});
+    // `to` is a backward visit even when there is no backward search.
+    sides[1].visits.emplace(to, Visit{0, INVALID_ROOM_ID, Direction::North});
+    if (_reciprocal) {
+      sides[1].open.push(Candidate{key(true, 0, to).value(), 0, to});
+    }
+
+    auto shortest = UNREACHABLE;
+    auto meeting = INVALID_ROOM_ID;
+    const auto done = [&] {
+      if (!_reciprocal) {
+        return sides[0].open.empty() ||
+               sides[0].open.top().key >= Key{shortest};
+      }
+      return sides[0].open.empty() || sides[1].open.empty() ||
+             sides[0].open.top().key + sides[1].open.top().key >=
+                 2 * Key{shortest};
+    };
+    while (!done()) {
+      const bool backward =
+          _reciprocal && sides[1].open.size() < sides[0].open.size();
+      auto& side = sides[backward ? 1 : 0];
+      const auto& other = sides[backward ? 0 : 1];
+      const auto candidate = side.open.top();
+      side.open.pop();
+      if (candidate.steps > side.visits.at(candidate.room).steps) {
+        continue;
+      }
+      const auto& exits = _exits[candidate.room];
+      for (const auto direction : exits.directions()) {
+        const auto target = exits.target(direction);
+        const auto steps = candidate.steps + 1;
+        // Backward visits record the step from the target into this room.
+        const Visit visit{
+            steps, candidate.room,
+            backward ? opposite_direction(direction) : direction};
+        const auto [found, inserted] = side.visits.try_emplace(target, visit);
+        if (!inserted) {
+          if (found->second.steps <= steps) {
+            continue;
+          }
+          found->second = visit;
+        }
+        if (const auto met = other.visits.find(target);
+            met != other.visits.end() &&
+            steps + met->second.steps < shortest) {
+          shortest = steps + met->second.steps;
+          meeting = target;
+        }
+        if (const auto target_key = key(backward, steps, target)) {
+          side.open.push(Candidate{target_key.value(), steps, target});
+        }
+      }
+    }
+    if (meeting == INVALID_ROOM_ID) {
+      return std::nullopt;
+    }
+
+    Route route;
+    route.reserve(shortest);
+    for (auto room = meeting; room != from;) {
+      const auto& visit = sides[0].visits.at(room);
+      route.push_back(visit.via);
+      room = visit.parent;
+    }
+    std::reverse(route.begin(), route.end());
+    for (auto room = meeting; room != to;) {
+      const auto& visit = sides[1].visits.at(room);
+      route.push_back(visit.via);
+      room = visit.parent;
+    }
+    return route;
+  }
+
+  std::optional<Route> find_route(IMap& map, RoomId from, RoomId to) {
+    if (from == to) {
+      return Route{};
+    }
+    std::unordered_map<RoomId, Visit> visits;
+    visits.emplace(from, Visit{0, INVALID_ROOM_ID, Direction::North});
+    std::vector<RoomId> queue{from};
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+      const auto room = queue[head];
+      const auto steps = visits.at(room).steps + 1;
+      for (const auto direction : map.available_exits(room)) {
+        const auto target = map.next_room(room, direction);
+        if (!target.has_value() ||
+            !visits.try_emplace(target.value(), Visit{steps, room, direction})
+                 .second) {
+          continue;
+        }
+        if (target.value() == to) {
+          Route route;
+          for (auto step = to; step != from;) {
+            const auto& visit = visits.at(step);
+            route.push_back(visit.via);
+            step = visit.parent;
+          }
+          std::reverse(route.begin(), route.end());
+          return route;
+        }
+        queue.push_back(target.value());
+      }
+    }
+    return std::nullopt;
+  }
+
+}  // namespace adv_sk
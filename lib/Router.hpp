@@ -0,0 +1,101 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"  // for Direction
+#include "IMap.hpp"       // for IMap
+#include "Map.hpp"        // for Map
+#include "Room.hpp"       // for Room, RoomConnections
+#include "Types.hpp"      // for RoomId
+
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint8_t, uint32_t
+#include <optional>  // for optional
+#include <span>      // for span
+#include <vector>    // for vector
+
+namespace adv_sk {
+
+  /// Directions to walk, in order, from one room to another.
+  using Route = std::vector<Direction>;
+
+  struct RouterOptions {
+    /// Worlds up to this many rooms get a next-hop table of rooms² bytes.
+    std::size_t next_hop_limit{1024};
+    /// Landmarks bounding the A* search on larger worlds.
+    std::size_t landmarks{8};
+  };
+
+  /**
+   * @brief Shortest-path queries over a snapshot of a world's exits.
+   *
+   * Small worlds precompute the first step of every shortest path, so a
+   * query only follows table entries. Larger worlds keep breadth-first
+   * distances from a few far-apart landmarks and answer with A*, using the
+   * triangle inequality over those distances as the lower bound (ALT).
+   * Queries are const and safe to run from many threads at once.
+   */
+  class Router {
+   public:
+    explicit Router(std::span<const Room> rooms,
+                    const RouterOptions& options = {});
+
+    explicit Router(const Map& map, const RouterOptions& options = {})
+        : Router(map.rooms(), options) {
+    }
+
+    /**
+     * @brief A shortest route, or nullopt when `to` cannot be reached.
+     *
+     * The route is empty when `from == to`. Throws std::out_of_range for
+     * rooms outside the world.
+     */
+    [[nodiscard]] std::optional<Route> route(RoomId from, RoomId to) const;
+
+    [[nodiscard]] std::size_t size() const {
+      return _exits.size();
+    }
+
+    [[nodiscard]] bool has_next_hop_table() const {
+      return !_next_hops.empty();
+    }
+
+    [[nodiscard]] std::size_t landmark_count() const {
+      return _landmarks;
+    }
+
+   private:
+    void build_next_hops();
+
+    void build_landmarks(std::size_t count);
+
+    [[nodiscard]] std::optional<Route> follow_next_hops(RoomId from,
+                                                        RoomId to) const;
+
+    [[nodiscard]] std::optional<Route> search(RoomId from, RoomId to) const;
+
+    /// Admissible estimate of the steps left; UNREACHABLE rules `room` out.
+    [[nodiscard]] std::uint32_t lower_bound(RoomId room, RoomId to) const;
+
+    /// Exits with targets outside the world dropped.
+    std::vector<RoomConnections> _exits{};
+    /// Direction index of the first step, at `from * size() + to`.
+    std::vector<std::uint8_t> _next_hops{};
+    /// Steps from each landmark, at `landmark * size() + room`.
+    std::vector<std::uint32_t> _landmark_distances{};
+    std::size_t _landmarks{0};
+    /// Every exit has a matching exit back, so distances are symmetric.
+    bool _reciprocal{true};
+  };
+
+  /**
+   * @brief Breadth-first shortest route through any IMap.
+   *
+   * For maps without a Router; visits rooms through next_room(), so it
+   * costs O(rooms + exits) per query.
+   */
+  std::optional<Route> find_route(IMap& map, RoomId from, RoomId to);
+
+}  // namespace adv_sk
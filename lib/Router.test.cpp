@@ -0,0 +1,149 @@
+// Router unit tests
+
+#include "Router.hpp"
+
+#include "ActionScript.hpp"          // for parse_script
+#include "Direction.hpp"             // for Direction
+#include "Game.hpp"                  // for Game
+#include "HeadlessInputHandler.hpp"  // for HeadlessInputHandler
+#include "Map.hpp"                   // for Map, create_map
+#include "Player.hpp"                // for Player
+#include "Room.hpp"                  // for Room
+#include "Types.hpp"                 // for RoomId
+#include "WorldGenerator.hpp"        // for generate_map, GeneratorOptions
+#include "gtest/gtest.h"             // for TEST, EXPECT_EQ
+
+#include <cstddef>    // for size_t
+#include <memory>     // for make_unique, make_shared
+#include <optional>   // for optional
+#include <stdexcept>  // for out_of_range
+#include <string>     // for string
+#include <vector>     // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    /// Walks `route` from `from`; INVALID_ROOM_ID if a step has no exit.
+    RoomId walk(const Map& map, RoomId from, const Route& route) {
+      for (const auto direction : route) {
+        from = map.get_room(from).connections().target(direction);
+        if (from == INVALID_ROOM_ID) {
+          break;
+        }
+      }
+      return from;
+    }
+
+    /// A Grid row of `length` rooms plus one room linked to nothing.
+    std::unique_ptr<Map> corridor(std::size_t length) {
+      std::vector<Room> rooms;
+      for (std::size_t room = 0; room < length; ++room) {
+        rooms.emplace_back(room == 0 ? std::string("GrandHall")
+                                     : "Room" + std::to_string(room),
+                           "You are in room " + std::to_string(room) + ".");
+        if (room > 0) {
+          rooms[room - 1].add_connection(Direction::East,
+                                         static_cast<RoomId>(room));
+          rooms[room].add_connection(Direction::West,
+                                     static_cast<RoomId>(room - 1));
+        }
+      }
+      rooms.emplace_back("Island");
+      return std::make_unique<Map>(std::move(rooms));
+    }
+  }  // namespace
+
+  TEST(Router, smallWorldsFollowTheNextHopTable) {
+    const auto map = corridor(5);
+    const Router router(*map);
+    EXPECT_TRUE(router.has_next_hop_table());
+    EXPECT_EQ(router.route(0, 3), Route(3, Direction::East));
+    EXPECT_EQ(router.route(3, 1), Route(2, Direction::West));
+    EXPECT_EQ(router.route(2, 2), Route{});
+    EXPECT_EQ(router.route(0, 5), std::nullopt);
+  }
+
+  TEST(Router, largeWorldsSearchWithLandmarks) {
+    const auto map = corridor(50);
+    const Router router(*map, RouterOptions{.next_hop_limit = 0});
+    EXPECT_FALSE(router.has_next_hop_table());
+    EXPECT_GT(router.landmark_count(), 0);
+    EXPECT_EQ(router.route(10, 40), Route(30, Direction::East));
+    EXPECT_EQ(router.route(49, 0), Route(49, Direction::West));
+    EXPECT_EQ(router.route(3, 50), std::nullopt);
+  }
+
+  TEST(Router, bothStrategiesFindShortestRoutesOnGeneratedWorlds) {
+    for (const auto topology : {Topology::Grid, Topology::Maze,
+                                Topology::RandomGraph, Topology::HubAndSpoke}) {
+      const auto map = generate_map(
+          GeneratorOptions{.topology = topology, .room_count = 400});
+      const Router table(*map);
+      const Router landmarks(*map, RouterOptions{.next_hop_limit = 0});
+      ASSERT_TRUE(table.has_next_hop_table());
+      for (RoomId from = 0; from < map->size(); from += 37) {
+        for (RoomId to = 0; to < map->size(); to += 23) {
+          const auto expected = find_route(*map, from, to);
+          const auto by_table = table.route(from, to);
+          const auto by_search = landmarks.route(from, to);
+          ASSERT_EQ(by_table.has_value(), expected.has_value());
+          ASSERT_EQ(by_search.has_value(), expected.has_value());
+          if (expected.has_value()) {
+            EXPECT_EQ(by_table->size(), expected->size());
+            EXPECT_EQ(by_search->size(), expected->size());
+            EXPECT_EQ(walk(*map, from, by_table.value()), to);
+            EXPECT_EQ(walk(*map, from, by_search.value()), to);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Router, oneWayExitsAreOnlyWalkedForwards) {
+    std::vector<Room> rooms{Room("GrandHall"), Room("Slide")};
+    rooms[0].add_connection(Direction::South, 1);
+    const Map map(std::move(rooms));
+    for (const auto limit : {std::size_t{1024}, std::size_t{0}}) {
+      const Router router(map, RouterOptions{.next_hop_limit = limit});
+      EXPECT_EQ(router.route(0, 1), Route{Direction::South});
+      EXPECT_EQ(router.route(1, 0), std::nullopt);
+    }
+  }
+
+  TEST(Router, unknownRoomsThrow) {
+    const Router router(*create_map());
+    EXPECT_THROW(static_cast<void>(router.route(0, 2)), std::out_of_range);
+  }
+
+  TEST(Router, travelMovesOnceWithOneMessage) {
+    std::string transcript;
+    const auto script =
+        parse_script("travel Room3; travel Island; travel Nope");
+    Game game(corridor(5), std::make_unique<Player>(),
+              std::make_unique<HeadlessInputHandler>(script, &transcript));
+    game.start();
+    EXPECT_EQ(transcript,
+              "You are in room 0.\n"
+              "Where do you want to go?\n"
+              "You pass through Room1, Room2.\nYou are in room 3.\n"
+              "Where do you want to go?\n"
+              "You find no way to Island.\n\n"
+              "Where do you want to go?\n"
+              "There is no Nope to go to.\n\n");
+  }
+
+  TEST(Router, travelUsesTheSharedRouterWhenSet) {
+    auto map = corridor(5);
+    auto router = std::make_shared<const Router>(*map);
+    Game game(std::move(map), std::make_unique<Player>(),
+              std::unique_ptr<IInputHandler>{});
+    game.set_router(router);
+    game.travel_to("Room4");
+    EXPECT_EQ(game.get_current_location(), "Room4");
+    game.travel_to("Room4");
+    EXPECT_EQ(game.get_current_message(), "You are already in Room4.\n");
+    game.travel_to("Room3");
+    EXPECT_EQ(game.get_current_message(), "You are in room 3.");
+  }
+
+}  // namespace adv_sk::test
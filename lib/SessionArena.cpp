@@ -0,0 +1,59 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "SessionArena.hpp"
+
+#include <algorithm>  // for max
+
+namespace adv_sk {
+
+  SessionArena::SessionArena(std::size_t initial_size,
+                             std::pmr::memory_resource* upstream)
+      : _upstream(upstream),
+        _chunks(std::max<std::size_t>(initial_size, 1), &_upstream),
+        _pool(&_chunks),
+        _front(&_pool) {
+  }
+
+  ArenaStats SessionArena::stats() const {
+    constexpr auto relaxed = std::memory_order_relaxed;
+    return ArenaStats{
+        .allocations = _front.allocations.load(relaxed),
+        .deallocations = _front.deallocations.load(relaxed),
+        .bytes_in_use = _front.bytes_in_use.load(relaxed),
+        .peak_bytes_in_use = _front.peak_bytes_in_use.load(relaxed),
+        .chunks = _upstream.allocations.load(relaxed) -
+                  _upstream.deallocations.load(relaxed),
+        .reserved_bytes = _upstream.bytes_in_use.load(relaxed),
+    };
+  }
+
+  void SessionArena::release() {
+    _pool.release();
+    _chunks.release();
+  }
+
+  void* SessionArena::CountingResource::do_allocate(std::size_t bytes,
+                                                    std::size_t alignment) {
+    auto* const pointer = _next->allocate(bytes, alignment);
+    constexpr auto relaxed = std::memory_order_relaxed;
+    allocations.store(allocations.load(relaxed) + 1, relaxed);
+    const auto in_use = bytes_in_use.load(relaxed) + bytes;
+    bytes_in_use.store(in_use, relaxed);
+    if (in_use > peak_bytes_in_use.load(relaxed)) {
+      peak_bytes_in_use.store(in_use, relaxed);
+    }
+    return pointer;
+  }
+
+  void SessionArena::CountingResource::do_deallocate(void* pointer,
+                                                     std::size_t bytes,
+                                                     std::size_t alignment) {
+    _next->deallocate(pointer, bytes, alignment);
+    constexpr auto relaxed = std::memory_order_relaxed;
+    deallocations.store(deallocations.load(relaxed) + 1, relaxed);
+    bytes_in_use.store(bytes_in_use.load(relaxed) - bytes, relaxed);
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,99 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include <atomic>           // for atomic
+#include <cstddef>          // for size_t
+#include <memory_resource>  // for memory_resource, polymorphic_allocator
+
+namespace adv_sk {
+
+  /// Memory use of one SessionArena.
+  struct ArenaStats {
+    /// Requests made by the session's objects.
+    std::size_t allocations{0};
+    std::size_t deallocations{0};
+    std::size_t bytes_in_use{0};
+    std::size_t peak_bytes_in_use{0};
+    /// Chunks taken from the upstream resource and not yet released.
+    std::size_t chunks{0};
+    std::size_t reserved_bytes{0};
+  };
+
+  /**
+   * @brief Memory for one session, handed back upstream in one piece.
+   *
+   * The session's objects allocate from a pool, so a freed block is reused
+   * by the next request of its size. The pool carves its blocks out of a
+   * monotonic buffer that grows in chunks taken from upstream. Nothing goes
+   * back upstream until release() or destruction, which frees every chunk
+   * at once however the session's objects were laid out.
+   *
+   * Not thread-safe: a session is stepped by one thread at a time. Only
+   * stats() may be called while another thread uses the arena.
+   */
+  class SessionArena {
+   public:
+    static constexpr std::size_t DEFAULT_INITIAL_SIZE = 4096;
+
+    explicit SessionArena(
+        std::size_t initial_size = DEFAULT_INITIAL_SIZE,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    SessionArena(const SessionArena&) = delete;
+    SessionArena& operator=(const SessionArena&) = delete;
+    SessionArena(SessionArena&&) = delete;
+    SessionArena& operator=(SessionArena&&) = delete;
+    ~SessionArena() = default;
+
+    [[nodiscard]] std::pmr::memory_resource* resource() {
+      return &_front;
+    }
+
+    [[nodiscard]] std::pmr::polymorphic_allocator<> allocator() {
+      return std::pmr::polymorphic_allocator<>(&_front);
+    }
+
+    [[nodiscard]] ArenaStats stats() const;
+
+    /// Frees every chunk; whatever was allocated from the arena must
+    /// already be destroyed.
+    void release();
+
+   private:
+    /// Forwards to another resource, counting what passes through.
+    class CountingResource final : public std::pmr::memory_resource {
+     public:
+      explicit CountingResource(std::pmr::memory_resource* upstream)
+          : _next(upstream) {
+      }
+
+      // Only the thread stepping the session writes these, so a relaxed
+      // load and store is enough; stats() may read them from any thread.
+      std::atomic<std::size_t> allocations{0};
+      std::atomic<std::size_t> deallocations{0};
+      std::atomic<std::size_t> bytes_in_use{0};
+      std::atomic<std::size_t> peak_bytes_in_use{0};
+
+     private:
+      void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+      void do_deallocate(void* pointer, std::size_t bytes,
+                         std::size_t alignment) override;
+      [[nodiscard]] bool do_is_equal(
+          const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+      }
+
+      std::pmr::memory_resource* _next;
+    };
+
+    // Declared upstream first, so each is destroyed after its users.
+    CountingResource _upstream;
+    std::pmr::monotonic_buffer_resource _chunks;
+    std::pmr::unsynchronized_pool_resource _pool;
+    CountingResource _front;
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,98 @@
+// SessionArena unit tests
+
+#include "SessionArena.hpp"
+
+#include "AllocationCounter.hpp"  // for AllocationCounter
+#include "Map.hpp"                // for create_map
+#include "Player.hpp"             // for Player
+#include "SessionMap.hpp"         // for SessionMap, SharedWorld
+#include "Types.hpp"              // for RoomId
+#include "gtest/gtest.h"          // for TEST, EXPECT_EQ
+
+#include <cstddef>          // for size_t
+#include <memory_resource>  // for memory_resource, new_delete_resource
+#include <vector>           // for pmr::vector
+
+namespace adv_sk::test {
+
+  namespace {
+    /// Counts the chunks an arena takes from the heap.
+    class ChunkCounter final : public std::pmr::memory_resource {
+     public:
+      std::size_t chunks{0};
+
+     private:
+      void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++chunks;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+      }
+
+      void do_deallocate(void* pointer, std::size_t bytes,
+                         std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes,
+                                                    alignment);
+      }
+
+      [[nodiscard]] bool do_is_equal(
+          const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+      }
+    };
+  }  // namespace
+
+  TEST(SessionArena, countsWhatTheSessionAllocates) {
+    SessionArena arena;
+    {
+      std::pmr::vector<int> numbers(arena.allocator());
+      numbers.resize(100);
+      const auto stats = arena.stats();
+      EXPECT_EQ(stats.allocations, 1);
+      EXPECT_GE(stats.bytes_in_use, 100 * sizeof(int));
+      EXPECT_GE(stats.reserved_bytes, stats.bytes_in_use);
+      EXPECT_GE(stats.chunks, 1);
+    }
+    const auto stats = arena.stats();
+    EXPECT_EQ(stats.deallocations, 1);
+    EXPECT_EQ(stats.bytes_in_use, 0);
+    EXPECT_GE(stats.peak_bytes_in_use, 100 * sizeof(int));
+  }
+
+  TEST(SessionArena, releaseReturnsEveryChunk) {
+    SessionArena arena(64);
+    {
+      std::pmr::vector<std::pmr::vector<int>> rows(arena.allocator());
+      for (std::size_t row = 0; row < 50; ++row) {
+        rows.emplace_back(row * 10, 0);
+      }
+    }
+    EXPECT_GT(arena.stats().chunks, 1);
+    arena.release();
+    EXPECT_EQ(arena.stats().chunks, 0);
+    EXPECT_EQ(arena.stats().reserved_bytes, 0);
+  }
+
+  TEST(SessionArena, sessionStateOnlyTakesChunksFromTheHeap) {
+    const SharedWorld world = create_map();
+    ChunkCounter heap;
+    SessionArena arena(SessionArena::DEFAULT_INITIAL_SIZE, &heap);
+
+    const auto chunks_before = heap.chunks;
+    const AllocationCounter allocations;
+    {
+      SessionMap map(world, arena.allocator());
+      Player player(arena.allocator());
+      for (RoomId room = 0; room < 2; ++room) {
+        auto& inventory = map.get_room(room).inventory();
+        inventory.reveal_all();
+        player.add_to_inventory(inventory.remove(inventory.find_visible(
+            inventory[0].name()).value()));
+      }
+      EXPECT_EQ(map.changed_rooms(), 2);
+      EXPECT_EQ(player.get_inventory().size(), 2);
+    }
+    EXPECT_EQ(allocations.count(), heap.chunks - chunks_before);
+    EXPECT_GT(arena.stats().allocations, 0);
+    EXPECT_EQ(arena.stats().bytes_in_use, 0);
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,154 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "SessionMap.hpp"
+
+#include <stdexcept>  // for invalid_argument, out_of_range
+#include <utility>    // for move
+
+namespace adv_sk {
+
+  SessionMap::SessionMap(SharedWorld world, allocator_type allocator)
+      : _world(std::move(world)),
+        _changes(allocator),
+        _whole_rooms(allocator),
+        _revealed(allocator) {
+    if (!_world) {
+      throw std::invalid_argument("SessionMap needs a world");
+    }
+  }
+
+  std::optional<std::string_view> SessionMap::next_room(
+      const RoomName& current_room, Direction direction) {
+    const auto room_id = find_room(current_room);
+    if (!room_id.has_value()) {
+      throw std::out_of_range("Unknown room: " + current_room);
+    }
+    const auto next = next_room(room_id.value(), direction);
+    if (!next.has_value()) {
+      return std::nullopt;
+    }
+    return get_room_name(next.value());
+  }
+
+  std::optional<RoomId> SessionMap::next_room(RoomId current_room,
+                                              Direction direction) {
+    return _world->get_room(current_room).connections().get_connection(
+        direction);
+  }
+
+  Room& SessionMap::get_room(const RoomName& room) {
+    const auto room_id = find_room(room);
+    if (!room_id.has_value()) {
+      throw std::out_of_range("Unknown room: " + room);
+    }
+    return get_room(room_id.value());
+  }
+
+  Room& SessionMap::get_room(RoomId room) {
+    if (const auto whole = _whole_rooms.find(room);
+        whole != _whole_rooms.end()) {
+      return whole->second;
+    }
+    const auto& shared = _world->get_room(room);
+    auto& whole = _whole_rooms.emplace(room, shared).first->second;
+    const auto changes = _changes.find(room);
+    if (changes == _changes.end() && !is_revealed(room)) {
+      return whole;
+    }
+    auto& inventory = whole.inventory();
+    inventory = Inventory(inventory.get_allocator());
+    for (std::size_t position = 0; position < shared.inventory().size();
+         ++position) {
+      if (changes == _changes.end() || !changes->second.is_taken(position)) {
+        inventory.add(shared.inventory()[position],
+                      is_revealed(room) ||
+                          shared.inventory().is_visible(position));
+      }
+    }
+    if (changes != _changes.end()) {
+      for (const auto& item : changes->second.dropped) {
+        inventory.add(item, true);
+      }
+      _changes.erase(changes);
+    }
+    return whole;
+  }
+
+  void SessionMap::set_bit(Bits& bits, std::size_t index) {
+    if (index / WORD_BITS >= bits.size()) {
+      bits.resize((index / WORD_BITS) + 1);
+    }
+    bits[index / WORD_BITS] |= std::uint64_t{1} << (index % WORD_BITS);
+  }
+
+  SessionMap::RoomChanges* SessionMap::find_changes(RoomId room) {
+    const auto changes = _changes.find(room);
+    return changes == _changes.end() ? nullptr : &changes->second;
+  }
+
+  std::size_t SessionMap::reveal_items(RoomId room,
+                                       const ItemVisitor& visit) {
+    if (_whole_rooms.contains(room)) {
+      return IMap::reveal_items(room, visit);
+    }
+    const auto& shared = _world->get_room(room).inventory();
+    const auto* changed = find_changes(room);
+    std::size_t found = 0;
+    for (std::size_t position = 0; position < shared.size(); ++position) {
+      if (changed == nullptr || !changed->is_taken(position)) {
+        visit(shared[position]);
+        ++found;
+      }
+    }
+    // Only shared items can be hidden, so only they need revealing.
+    if (found != 0) {
+      set_bit(_revealed, room);
+    }
+    if (changed != nullptr) {
+      for (const auto& item : changed->dropped) {
+        visit(item);
+      }
+      found += changed->dropped.size();
+    }
+    return found;
+  }
+
+  std::optional<InventoryItem> SessionMap::take_visible_item(
+      RoomId room, std::string_view name) {
+    if (_whole_rooms.contains(room)) {
+      return IMap::take_visible_item(room, name);
+    }
+    const auto& shared = _world->get_room(room).inventory();
+    auto* changed = find_changes(room);
+    const bool revealed = is_revealed(room);
+    if (const auto item =
+            shared.find_named(name, [&](std::size_t position) {
+              return (revealed || shared.is_visible(position)) &&
+                     (changed == nullptr || !changed->is_taken(position));
+            })) {
+      const auto position = shared.position(item.value());
+      if (changed == nullptr) {
+        changed = &_changes.try_emplace(room).first->second;
+      }
+      set_bit(changed->taken, position);
+      return shared[position];
+    }
+    if (changed != nullptr) {
+      if (const auto item = changed->dropped.find_visible(name)) {
+        return changed->dropped.remove(item.value());
+      }
+    }
+    return std::nullopt;
+  }
+
+  void SessionMap::put_item(RoomId room, const InventoryItem& item) {
+    if (_whole_rooms.contains(room)) {
+      IMap::put_item(room, item);
+    } else {
+      _changes.try_emplace(room).first->second.dropped.add(item, true);
+    }
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,141 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"  // for Direction, DirectionSet
+#include "IMap.hpp"       // for IMap, ItemVisitor
+#include "Inventory.hpp"  // for Inventory, InventoryItem
+#include "Map.hpp"        // for Map
+#include "Room.hpp"       // for Room
+#include "Types.hpp"      // for RoomName, RoomId
+
+#include <cstddef>          // for size_t
+#include <cstdint>          // for uint64_t
+#include <memory>           // for shared_ptr
+#include <memory_resource>  // for polymorphic_allocator
+#include <optional>         // for optional
+#include <string_view>      // for string_view
+#include <unordered_map>    // for pmr::unordered_map
+#include <vector>           // for pmr::vector
+
+namespace adv_sk {
+
+  /// World definition shared read-only by every session.
+  using SharedWorld = std::shared_ptr<const Map>;
+
+  /**
+   * @brief One player's view of a shared world.
+   *
+   * Names, messages, exits and the initial items are read straight from
+   * the shared Map. The per-session overlay keeps only what the player
+   * changed: for each room, which of its shared items were taken and the
+   * items dropped there, and one visibility bit per room the player has
+   * searched. Searching sets a bit and failing to take changes nothing.
+   * Memory per session grows with those changes, not with the world size,
+   * and comes from the allocator given, such as a SessionArena's.
+   *
+   * A room's items are listed shared ones first, in the world's order,
+   * then the dropped ones. get_room() hands out a whole private copy of
+   * the room with the changes applied, for callers that need one; that
+   * room's items then live in the copy.
+   */
+  class SessionMap : public IMap {
+   public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    explicit SessionMap(SharedWorld world, allocator_type allocator = {});
+
+    [[nodiscard]] std::optional<RoomId> find_room(
+        const RoomName& room) const override {
+      return _world->find_room(room);
+    }
+
+    std::optional<std::string_view> next_room(const RoomName& current_room,
+                                              Direction direction) override;
+
+    std::optional<RoomId> next_room(RoomId current_room,
+                                    Direction direction) override;
+
+    [[nodiscard]] DirectionSet available_exits(RoomId room) const override {
+      return _world->available_exits(room);
+    }
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        const RoomName& room) const override {
+      return _world->get_welcome_message(room);
+    }
+
+    [[nodiscard]] std::string_view get_welcome_message(
+        RoomId room) const override {
+      return _world->get_welcome_message(room);
+    }
+
+    [[nodiscard]] std::string_view get_room_name(RoomId room) const override {
+      return _world->get_room_name(room);
+    }
+
+    [[nodiscard]] Room& get_room(const RoomName& room) override;
+
+    [[nodiscard]] Room& get_room(RoomId room) override;
+
+    std::size_t reveal_items(RoomId room, const ItemVisitor& visit) override;
+
+    std::optional<InventoryItem> take_visible_item(
+        RoomId room, std::string_view name) override;
+
+    void put_item(RoomId room, const InventoryItem& item) override;
+
+    /// Number of rooms this session has changed.
+    [[nodiscard]] std::size_t changed_rooms() const {
+      return _changes.size() + _whole_rooms.size();
+    }
+
+   private:
+    using Bits = std::pmr::vector<std::uint64_t>;
+
+    static constexpr std::size_t WORD_BITS = 64;
+
+    [[nodiscard]] static bool test_bit(const Bits& bits, std::size_t index) {
+      return index / WORD_BITS < bits.size() &&
+             (bits[index / WORD_BITS] >> (index % WORD_BITS) & 1U) != 0;
+    }
+
+    /// Grows `bits` as far as `index` needs.
+    static void set_bit(Bits& bits, std::size_t index);
+
+    /// What the session changed in one room's items.
+    struct RoomChanges {
+      using allocator_type = std::pmr::polymorphic_allocator<>;
+
+      explicit RoomChanges(allocator_type allocator)
+          : taken(allocator), dropped(allocator) {
+      }
+
+      [[nodiscard]] bool is_taken(std::size_t position) const {
+        return test_bit(taken, position);
+      }
+
+      /// One bit per position in the shared room's inventory.
+      Bits taken;
+      /// Always revealed; listed after the shared items.
+      Inventory dropped;
+    };
+
+    [[nodiscard]] RoomChanges* find_changes(RoomId room);
+
+    /// Whether the session searched `room`, revealing its shared items.
+    [[nodiscard]] bool is_revealed(RoomId room) const {
+      return test_bit(_revealed, room);
+    }
+
+    SharedWorld _world;
+    /// All three live in the map's own allocator.
+    std::pmr::unordered_map<RoomId, RoomChanges> _changes;
+    std::pmr::unordered_map<RoomId, Room> _whole_rooms;
+    /// One bit per room, up to the highest room searched.
+    Bits _revealed;
+  };
+
+}  // namespace adv_sk
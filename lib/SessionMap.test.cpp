@@ -0,0 +1,150 @@
+// SessionMap unit tests
+
+#include "SessionMap.hpp"
+
+#include "Direction.hpp"       // for Direction
+#include "Game.hpp"            // for Game
+#include "IInputHandler.hpp"   // for IInputHandler
+#include "Inventory.hpp"       // for InventoryItem
+#include "Map.hpp"             // for Map, create_map
+#include "Player.hpp"          // for Player
+#include "Types.hpp"           // for RoomId
+#include "WorldGenerator.hpp"  // for generate_map, GeneratorOptions
+#include "gtest/gtest.h"       // for TEST, EXPECT_EQ
+
+#include <memory>     // for make_shared, make_unique
+#include <optional>   // for optional
+#include <stdexcept>  // for out_of_range, invalid_argument
+#include <string>     // for string
+#include <vector>     // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    SharedWorld make_world() {
+      return create_map();
+    }
+  }  // namespace
+
+  TEST(SessionMap, readsThroughToSharedWorld) {
+    const auto world = make_world();
+    SessionMap session(world);
+
+    const auto grand_hall = session.find_room("GrandHall");
+    ASSERT_TRUE(grand_hall.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    EXPECT_EQ(session.get_welcome_message(*grand_hall),
+              world->get_welcome_message(*grand_hall));
+    EXPECT_EQ(session.next_room(*grand_hall, Direction::North),
+              world->find_room("Armoury"));
+    EXPECT_EQ(session.next_room("Armoury", Direction::South), "GrandHall");
+    EXPECT_FALSE(session.next_room(*grand_hall, Direction::West).has_value());
+    EXPECT_EQ(session.available_exits(*grand_hall),
+              world->available_exits(*grand_hall));
+    // NOLINTEND(bugprone-unchecked-optional-access)
+    EXPECT_EQ(session.changed_rooms(), 0);
+  }
+
+  TEST(SessionMap, changesStayInTheirSession) {
+    const auto world = make_world();
+    SessionMap first(world);
+    SessionMap second(world);
+
+    first.get_room("GrandHall").inventory().clear();
+
+    EXPECT_TRUE(first.get_room("GrandHall").inventory().empty());
+    EXPECT_EQ(second.get_room("GrandHall").inventory().size(), 1);
+    EXPECT_EQ(world->get_room(0).inventory().size(), 1);
+  }
+
+  TEST(SessionMap, overlayGrowsWithChangedRoomsOnly) {
+    const SharedWorld world =
+        generate_map(GeneratorOptions{.room_count = 10'000});
+    SessionMap session(world);
+    EXPECT_EQ(session.changed_rooms(), 0);
+
+    auto& room = session.get_room(RoomId{42});
+    EXPECT_EQ(&session.get_room(RoomId{42}), &room);
+    EXPECT_EQ(session.changed_rooms(), 1);
+  }
+
+  TEST(SessionMap, lookingAndFailedTakesChangeNothing) {
+    const auto world = make_world();
+    SessionMap session(world);
+    const RoomId grand_hall = world->find_room("GrandHall").value();
+
+    EXPECT_FALSE(
+        session.take_visible_item(grand_hall, "golden chalice").has_value());
+    EXPECT_EQ(session.changed_rooms(), 0);
+
+    std::vector<std::string> found;
+    EXPECT_EQ(session.reveal_items(grand_hall,
+                                   [&found](const InventoryItem& item) {
+                                     found.push_back(item.name());
+                                   }),
+              1);
+    EXPECT_EQ(found, std::vector<std::string>{"golden chalice"});
+    EXPECT_FALSE(session.take_visible_item(grand_hall, "torch").has_value());
+    EXPECT_EQ(session.changed_rooms(), 0);
+    EXPECT_TRUE(
+        session.take_visible_item(grand_hall, "golden chalice").has_value());
+    EXPECT_EQ(session.changed_rooms(), 1);
+  }
+
+  TEST(SessionMap, keepsTakenAndDroppedItemsAsChanges) {
+    const auto world = make_world();
+    SessionMap session(world);
+    const RoomId grand_hall = world->find_room("GrandHall").value();
+    session.reveal_items(grand_hall, [](const InventoryItem&) {});
+
+    const auto chalice = session.take_visible_item(grand_hall,
+                                                   "golden chalice");
+    ASSERT_TRUE(chalice.has_value());
+    EXPECT_FALSE(
+        session.take_visible_item(grand_hall, "golden chalice").has_value());
+    session.put_item(grand_hall, InventoryItem("torch"));
+    EXPECT_EQ(world->get_room(grand_hall).inventory().size(), 1);
+
+    // A whole copy of the room shows the same items.
+    const auto& room = session.get_room(grand_hall);
+    ASSERT_EQ(room.inventory().size(), 1);
+    EXPECT_EQ(room.inventory()[0].name(), "torch");
+    EXPECT_TRUE(room.inventory().is_visible(0));
+    EXPECT_EQ(session.changed_rooms(), 1);
+    EXPECT_TRUE(session.take_visible_item(grand_hall, "torch").has_value());
+    EXPECT_TRUE(session.get_room(grand_hall).inventory().empty());
+  }
+
+  TEST(SessionMap, unknownRoomThrows) {
+    SessionMap session(make_world());
+    EXPECT_THROW(static_cast<void>(session.get_room("Attic")),
+                 std::out_of_range);
+    EXPECT_THROW(
+        static_cast<void>(session.next_room("Attic", Direction::North)),
+        std::out_of_range);
+  }
+
+  TEST(SessionMap, requiresWorld) {
+    EXPECT_THROW(SessionMap(nullptr), std::invalid_argument);
+  }
+
+  TEST(SessionMap, gamesSharingWorldKeepSeparateItems) {
+    const auto world = make_world();
+    Game first(std::make_unique<SessionMap>(world), std::make_unique<Player>(),
+               std::unique_ptr<IInputHandler>{});
+    Game second(std::make_unique<SessionMap>(world),
+                std::make_unique<Player>(), std::unique_ptr<IInputHandler>{});
+
+    first.investigate();
+    first.take_item("golden chalice");
+    EXPECT_EQ(first.get_current_message(), "You take the golden chalice\n");
+
+    second.take_item("golden chalice");
+    EXPECT_EQ(second.get_current_message(),
+              "You can't take the golden chalice\n");
+    second.investigate();
+    second.take_item("golden chalice");
+    EXPECT_EQ(second.get_current_message(), "You take the golden chalice\n");
+  }
+
+}  // namespace adv_sk::test
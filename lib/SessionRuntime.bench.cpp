@@ -0,0 +1,68 @@
+// SessionRuntime benchmarks
+
+#include "SessionRuntime.hpp"
+
+#include "ActionScript.hpp"       // for parse_script
+#include "Player.hpp"             // for Player
+#include "SessionMap.hpp"         // for SessionMap, SharedWorld
+#include "WorldGenerator.hpp"     // for generate_map, GeneratorOptions
+#include "benchmark/benchmark.h"  // for State, BENCHMARK, Counter
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <memory>   // for make_unique
+#include <vector>   // for vector
+
+namespace adv_sk::bench {
+
+  namespace {
+    constexpr std::size_t SESSIONS = 10'000;
+
+    /// Steps SESSIONS players through a short script on `range(0)` workers;
+    /// with `range(1)` set, each session's state lives in its own arena.
+    void BM_RuntimeStepsSessions(benchmark::State& state) {
+      const SharedWorld world =
+          generate_map(GeneratorOptions{.room_count = 10'000});
+      const auto script = parse_script(
+          "investigate; take item0; move North; move East; inventory;"
+          "move South; drop item0; move West; investigate; inventory");
+
+      SessionRuntime runtime(static_cast<std::size_t>(state.range(0)));
+      std::vector<SessionId> sessions;
+      sessions.reserve(SESSIONS);
+      for (std::size_t index = 0; index < SESSIONS; ++index) {
+        sessions.push_back(
+            state.range(1) != 0
+                ? runtime.add_session(world)
+                : runtime.add_session(std::make_unique<SessionMap>(world),
+                                      std::make_unique<Player>()));
+      }
+
+      for (auto _ : state) {
+        for (const auto session : sessions) {
+          runtime.submit(session, script);
+        }
+        runtime.wait_idle();
+      }
+
+      std::uint64_t steals = 0;
+      double utilisation = 0.0;
+      for (const auto& worker : runtime.worker_stats()) {
+        steals += worker.steals;
+        utilisation += worker.utilisation;
+      }
+      state.counters["actions/s"] = benchmark::Counter(
+          static_cast<double>(state.iterations() * SESSIONS * script.size()),
+          benchmark::Counter::kIsRate);
+      state.counters["steals"] = static_cast<double>(steals);
+      state.counters["utilisation"] =
+          utilisation / static_cast<double>(runtime.worker_count());
+    }
+    BENCHMARK(BM_RuntimeStepsSessions)
+        ->ArgsProduct({{1, 2, 4, 8}, {0, 1}})
+        ->ArgNames({"workers", "arena"})
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+  }  // namespace
+
+}  // namespace adv_sk::bench
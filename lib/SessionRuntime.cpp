@@ -0,0 +1,377 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "SessionRuntime.hpp"
+
+#include "ActionJournal.hpp"  // for ActionJournal
+#include "Direction.hpp"      // for Direction, DirectionSet
+#include "Game.hpp"           // for Game
+#include "IInputHandler.hpp"  // for IInputHandler, Action
+#include "Player.hpp"         // for Player
+
+#include <algorithm>    // for max
+#include <exception>    // for exception
+#include <optional>     // for optional
+#include <stdexcept>    // for out_of_range, logic_error
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+namespace adv_sk {
+
+  namespace {
+    /// Hands the Game the step its session is currently running.
+    class SessionInputHandler : public IInputHandler {
+     public:
+      SessionInputHandler(const ScriptStep& current, std::string* transcript,
+                          const std::unique_ptr<OutputQueue>& output)
+          : _current(current), _transcript(transcript), _output(output) {
+      }
+
+      Action get_action() override {
+        return _current.action;
+      }
+
+      void provide_directions(DirectionSet /*directions*/) override {
+      }
+
+      std::optional<Direction> get_direction() override {
+        return _current.direction;
+      }
+
+      std::string get_item_name() override {
+        return _current.item_name;
+      }
+
+      std::string get_room_name() override {
+        return _current.room_name;
+      }
+
+      void provide_message(std::string_view message) override {
+        if (_transcript != nullptr) {
+          _transcript->append(message).push_back('\n');
+        }
+        if (_output) {
+          _output->push(message);
+        }
+      }
+
+     private:
+      const ScriptStep& _current;
+      std::string* _transcript;
+      const std::unique_ptr<OutputQueue>& _output;
+    };
+  }  // namespace
+
+  struct SessionRuntime::Session {
+    /// First, so it outlives everything allocated from it.
+    SessionArena arena{};
+    std::mutex mutex{};
+    std::deque<ScriptStep> pending{};
+    /// Step being handled; only touched by the worker running the session.
+    ScriptStep current{};
+    bool scheduled{false};
+    bool finished{false};
+    /// Set, with `finished`, when an action throws.
+    std::string error{};
+    std::string transcript{};
+    /// Declared before the game, which writes to both.
+    std::unique_ptr<OutputQueue> output{};
+    std::unique_ptr<ActionJournal> journal{};
+    std::unique_ptr<Game> game{};
+  };
+
+  SessionRuntime::SessionRuntime(std::size_t workers, bool collect_output)
+      : _collect_output(collect_output),
+        _started(std::chrono::steady_clock::now()) {
+    workers = std::max<std::size_t>(workers, 1);
+    _workers.reserve(workers);
+    for (std::size_t worker = 0; worker < workers; ++worker) {
+      _workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t worker = 0; worker < workers; ++worker) {
+      _workers[worker]->thread = std::thread([this, worker] { work(worker); });
+    }
+  }
+
+  SessionRuntime::~SessionRuntime() {
+    stop();
+  }
+
+  SessionId SessionRuntime::add_session(std::unique_ptr<IMap> map,
+                                        std::unique_ptr<IPlayer> player) {
+    return add_session(std::make_unique<Session>(), std::move(map),
+                       std::move(player));
+  }
+
+  SessionId SessionRuntime::add_session(SharedWorld world) {
+    auto session = std::make_unique<Session>();
+    const auto allocator = session->arena.allocator();
+    auto map = std::make_unique<SessionMap>(std::move(world), allocator);
+    auto player = std::make_unique<Player>(allocator);
+    return add_session(std::move(session), std::move(map), std::move(player));
+  }
+
+  SessionId SessionRuntime::add_session(std::unique_ptr<Session> session,
+                                        std::unique_ptr<IMap> map,
+                                        std::unique_ptr<IPlayer> player) {
+    auto input = std::make_unique<SessionInputHandler>(
+        session->current, _collect_output ? &session->transcript : nullptr,
+        session->output);
+    session->game = std::make_unique<Game>(std::move(map), std::move(player),
+                                           std::move(input),
+                                           session->arena.allocator());
+
+    const std::lock_guard lock(_sessions_mutex);
+    _sessions.push_back(std::move(session));
+    return _sessions.size() - 1;
+  }
+
+  SessionRuntime::Session& SessionRuntime::session_at(
+      SessionId session) const {
+    const std::lock_guard lock(_sessions_mutex);
+    if (session >= _sessions.size()) {
+      throw std::out_of_range("Unknown session: " + std::to_string(session));
+    }
+    return *_sessions[session];
+  }
+
+  void SessionRuntime::attach_output(SessionId session, int descriptor,
+                                     OverflowPolicy policy,
+                                     std::size_t capacity) {
+    session_at(session).output =
+        std::make_unique<OutputQueue>(descriptor, capacity, policy);
+  }
+
+  void SessionRuntime::record_journal(SessionId session,
+                                      const std::filesystem::path& path) {
+    auto& target = session_at(session);
+    // Holding the lock keeps submit() from scheduling the session meanwhile.
+    const std::lock_guard lock(target.mutex);
+    if (target.finished) {
+      throw std::logic_error("Session has finished");
+    }
+    if (target.scheduled) {
+      throw std::logic_error("Session is running");
+    }
+    target.journal =
+        std::make_unique<ActionJournal>(ActionJournal::create(path));
+    target.game->set_journal(target.journal.get());
+  }
+
+  bool SessionRuntime::submit(SessionId session,
+                              std::span<const ScriptStep> steps) {
+    auto& target = session_at(session);
+    bool start = false;
+    {
+      const std::lock_guard lock(target.mutex);
+      if (target.finished || _stopping) {
+        return false;
+      }
+      target.pending.insert(target.pending.end(), steps.begin(), steps.end());
+      _outstanding += steps.size();
+      if (!target.scheduled && !target.pending.empty()) {
+        target.scheduled = true;
+        start = true;
+      }
+    }
+    if (start) {
+      schedule(target, _next_worker++ % _workers.size());
+    }
+    return true;
+  }
+
+  void SessionRuntime::schedule(Session& session, std::size_t worker,
+                                bool yielded) {
+    {
+      auto& ready = _workers[worker]->ready;
+      const std::lock_guard lock(_workers[worker]->mutex);
+      if (yielded) {
+        ready.push_front(&session);
+      } else {
+        ready.push_back(&session);
+      }
+    }
+    ++_ready;
+    if (_sleeping > 0) {
+      const std::lock_guard lock(_sleep_mutex);
+      _wake.notify_one();
+    }
+  }
+
+  SessionRuntime::Session* SessionRuntime::next_session(std::size_t worker) {
+    {
+      auto& own = *_workers[worker];
+      const std::lock_guard lock(own.mutex);
+      if (!own.ready.empty()) {
+        auto* session = own.ready.back();
+        own.ready.pop_back();
+        --_ready;
+        return session;
+      }
+    }
+    for (std::size_t offset = 1; offset < _workers.size(); ++offset) {
+      auto& victim = *_workers[(worker + offset) % _workers.size()];
+      const std::lock_guard lock(victim.mutex);
+      if (!victim.ready.empty()) {
+        auto* session = victim.ready.front();
+        victim.ready.pop_front();
+        --_ready;
+        ++_workers[worker]->steals;
+        return session;
+      }
+    }
+    return nullptr;
+  }
+
+  void SessionRuntime::run_step(Session& session, std::size_t worker) {
+    {
+      const std::lock_guard lock(session.mutex);
+      session.current = std::move(session.pending.front());
+      session.pending.pop_front();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    bool running = false;
+    std::string error;
+    try {
+      running = session.game->handle_user_action();
+    } catch (const std::exception& exception) {
+      error = exception.what();
+    } catch (...) {
+      error = "Unknown error";
+    }
+    const auto busy = std::chrono::steady_clock::now() - start;
+    auto& stats = *_workers[worker];
+    stats.busy_ns.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(busy).count(),
+        std::memory_order_relaxed);
+    stats.steps.fetch_add(1, std::memory_order_relaxed);
+    if (!running) {
+      session.game.reset();
+      if (session.journal) {
+        try {
+          session.journal->flush();
+        } catch (const std::exception& exception) {
+          if (error.empty()) {
+            error = std::string("Journal: ") + exception.what();
+          }
+        }
+        session.journal.reset();
+      }
+      session.arena.release();
+    }
+
+    std::size_t handled = 1;
+    bool again = false;
+    {
+      const std::lock_guard lock(session.mutex);
+      if (!running) {
+        session.finished = true;
+        session.error = std::move(error);
+        handled += session.pending.size();
+        session.pending.clear();
+      }
+      again = !session.pending.empty();
+      session.scheduled = again;
+    }
+    if (again) {
+      schedule(session, worker, true);
+    }
+    finish_actions(handled);
+  }
+
+  void SessionRuntime::work(std::size_t worker) {
+    while (!_stopping) {
+      if (auto* session = next_session(worker); session != nullptr) {
+        run_step(*session, worker);
+        continue;
+      }
+      std::unique_lock lock(_sleep_mutex);
+      ++_sleeping;
+      _wake.wait(lock, [this] { return _stopping || _ready > 0; });
+      --_sleeping;
+    }
+  }
+
+  void SessionRuntime::finish_actions(std::size_t count) {
+    if (_outstanding.fetch_sub(count) == count) {
+      const std::lock_guard lock(_idle_mutex);
+      _idle.notify_all();
+    }
+  }
+
+  void SessionRuntime::wait_idle() {
+    std::unique_lock lock(_idle_mutex);
+    _idle.wait(lock, [this] { return _outstanding == 0; });
+  }
+
+  void SessionRuntime::stop() {
+    {
+      const std::lock_guard lock(_sleep_mutex);
+      if (_stopping.exchange(true)) {
+        return;
+      }
+      _wake.notify_all();
+    }
+    for (auto& worker : _workers) {
+      worker->thread.join();
+    }
+    const std::lock_guard lock(_idle_mutex);
+    _outstanding = 0;
+    _idle.notify_all();
+  }
+
+  bool SessionRuntime::finished(SessionId session) const {
+    auto& target = session_at(session);
+    const std::lock_guard lock(target.mutex);
+    return target.finished;
+  }
+
+  std::string SessionRuntime::error(SessionId session) const {
+    auto& target = session_at(session);
+    const std::lock_guard lock(target.mutex);
+    return target.error;
+  }
+
+  std::string SessionRuntime::transcript(SessionId session) const {
+    return session_at(session).transcript;
+  }
+
+  ArenaStats SessionRuntime::memory(SessionId session) const {
+    return session_at(session).arena.stats();
+  }
+
+  OutputStats SessionRuntime::output_stats(SessionId session) const {
+    const auto& output = session_at(session).output;
+    return output ? output->stats() : OutputStats{};
+  }
+
+  void SessionRuntime::flush_output(SessionId session) {
+    if (auto& output = session_at(session).output) {
+      output->flush();
+    }
+  }
+
+  std::vector<WorkerStats> SessionRuntime::worker_stats() const {
+    const auto lifetime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - _started);
+    std::vector<WorkerStats> stats;
+    stats.reserve(_workers.size());
+    for (const auto& worker : _workers) {
+      const std::chrono::nanoseconds busy(
+          worker->busy_ns.load(std::memory_order_relaxed));
+      stats.push_back(WorkerStats{
+          .steps = worker->steps.load(std::memory_order_relaxed),
+          .steals = worker->steals.load(std::memory_order_relaxed),
+          .busy = busy,
+          .utilisation = lifetime.count() > 0
+                             ? static_cast<double>(busy.count()) /
+                                   static_cast<double>(lifetime.count())
+                             : 0.0});
+    }
+    return stats;
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,191 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "ActionScript.hpp"  // for ScriptStep
+#include "IMap.hpp"          // for IMap
+#include "IPlayer.hpp"       // for IPlayer
+#include "OutputQueue.hpp"   // for OutputQueue, OutputStats
+#include "SessionArena.hpp"  // for ArenaStats
+#include "SessionMap.hpp"    // for SharedWorld
+
+#include <atomic>              // for atomic
+#include <chrono>              // for nanoseconds, steady_clock
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <cstdint>             // for uint64_t
+#include <deque>               // for deque
+#include <filesystem>          // for path
+#include <memory>              // for unique_ptr
+#include <mutex>               // for mutex
+#include <span>                // for span
+#include <string>              // for string
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+namespace adv_sk {
+
+  using SessionId = std::size_t;
+
+  struct WorkerStats {
+    /// Calls to Game::handle_user_action made by this worker.
+    std::uint64_t steps{0};
+    /// Sessions this worker took from another worker's deque.
+    std::uint64_t steals{0};
+    /// Time spent inside handle_user_action.
+    std::chrono::nanoseconds busy{0};
+    /// `busy` relative to the runtime's lifetime so far, in [0, 1].
+    double utilisation{0.0};
+  };
+
+  /**
+   * @brief Steps many independent games on a fixed pool of worker threads.
+   *
+   * Each session is a Game fed from its own input queue. A session is
+   * scheduled on a worker's deque when an action arrives while it is idle.
+   * It runs for exactly one handle_user_action() and is then put back on
+   * the front of that worker's deque if more actions are waiting. Workers
+   * pop their own deque from the back and steal from the front of the
+   * others' when empty, so no thread ever blocks on a player's input, and
+   * a session that keeps yielding queues behind every waiting one instead
+   * of starving it.
+   *
+   * A session that handles Action::Quit is finished: its remaining actions
+   * are dropped and further submits are rejected. So is a session whose
+   * action throws; error() then says why, and the worker carries on with
+   * the other sessions.
+   *
+   * Every session owns a SessionArena that its game's reply buffer, and
+   * for sessions over a SharedWorld also its room overlays and player
+   * inventory, allocate from. A finished session's game is destroyed and
+   * its arena released in one go.
+   *
+   * A session can also write its messages to a descriptor through an
+   * OutputQueue, so a slow client never holds up the worker stepping it.
+   */
+  class SessionRuntime {
+   public:
+    explicit SessionRuntime(
+        std::size_t workers = std::thread::hardware_concurrency(),
+        bool collect_output = false);
+    ~SessionRuntime();
+
+    SessionRuntime(const SessionRuntime&) = delete;
+    SessionRuntime& operator=(const SessionRuntime&) = delete;
+    SessionRuntime(SessionRuntime&&) = delete;
+    SessionRuntime& operator=(SessionRuntime&&) = delete;
+
+    SessionId add_session(std::unique_ptr<IMap> map,
+                          std::unique_ptr<IPlayer> player);
+
+    /// A SessionMap over `world` and a Player, both in the session's arena.
+    SessionId add_session(SharedWorld world);
+
+    /**
+     * @brief Sends the session's messages to `descriptor` from now on.
+     *
+     * The caller keeps the descriptor open while the runtime lives. Call it
+     * before submitting actions to the session.
+     */
+    void attach_output(SessionId session, int descriptor,
+                       OverflowPolicy policy = OverflowPolicy::Block,
+                       std::size_t capacity = OutputQueue::DEFAULT_CAPACITY);
+
+    /**
+     * @brief Journals the session's actions from now on to a new file.
+     *
+     * Records are appended as the journal's buffer fills, so a long session
+     * holds no more than that in memory; the rest is written and the file
+     * closed when the session finishes, and a failed write becomes the
+     * session's error(). Call it while the session is idle, as after
+     * wait_idle(): throws std::logic_error if it is running or finished,
+     * and std::runtime_error if the file cannot be created.
+     */
+    void record_journal(SessionId session, const std::filesystem::path& path);
+
+    /// Queues actions for a session; false once the session has finished.
+    bool submit(SessionId session, std::span<const ScriptStep> steps);
+    bool submit(SessionId session, const ScriptStep& step) {
+      return submit(session, std::span<const ScriptStep>(&step, 1));
+    }
+
+    /// Blocks until every submitted action has been handled or dropped.
+    void wait_idle();
+
+    /// Finishes the steps in flight, drops queued ones and joins the workers.
+    void stop();
+
+    [[nodiscard]] bool finished(SessionId session) const;
+
+    /// What the action that ended the session threw, or why its journal
+    /// could not be written; empty if neither happened.
+    [[nodiscard]] std::string error(SessionId session) const;
+
+    /**
+     * @brief Messages of a session so far; empty unless output is collected.
+     *
+     * Only safe while the session is not running, e.g. after wait_idle().
+     */
+    [[nodiscard]] std::string transcript(SessionId session) const;
+
+    /// The session's arena use; may be read while the session runs.
+    [[nodiscard]] ArenaStats memory(SessionId session) const;
+
+    /// The session's output queue; all zero without attach_output().
+    [[nodiscard]] OutputStats output_stats(SessionId session) const;
+
+    /// Waits until the session's queued messages are written; only safe
+    /// while the session is not running.
+    void flush_output(SessionId session);
+
+    [[nodiscard]] std::vector<WorkerStats> worker_stats() const;
+
+    [[nodiscard]] std::size_t worker_count() const {
+      return _workers.size();
+    }
+
+   private:
+    struct Session;
+
+    struct alignas(64) Worker {
+      std::mutex mutex{};
+      std::deque<Session*> ready{};
+      std::atomic<std::uint64_t> steps{0};
+      std::atomic<std::uint64_t> steals{0};
+      std::atomic<std::int64_t> busy_ns{0};
+      std::thread thread{};
+    };
+
+    SessionId add_session(std::unique_ptr<Session> session,
+                          std::unique_ptr<IMap> map,
+                          std::unique_ptr<IPlayer> player);
+    [[nodiscard]] Session& session_at(SessionId session) const;
+    /// `yielded` sessions just ran a step and go behind the waiting ones.
+    void schedule(Session& session, std::size_t worker, bool yielded = false);
+    Session* next_session(std::size_t worker);
+    void run_step(Session& session, std::size_t worker);
+    void work(std::size_t worker);
+    void finish_actions(std::size_t count);
+
+    std::vector<std::unique_ptr<Worker>> _workers{};
+    bool _collect_output;
+    std::chrono::steady_clock::time_point _started;
+
+    mutable std::mutex _sessions_mutex{};
+    std::vector<std::unique_ptr<Session>> _sessions{};
+
+    std::atomic<std::size_t> _next_worker{0};
+    std::atomic<std::size_t> _ready{0};
+    std::atomic<std::size_t> _sleeping{0};
+    std::atomic<bool> _stopping{false};
+    std::mutex _sleep_mutex{};
+    std::condition_variable _wake{};
+
+    std::atomic<std::size_t> _outstanding{0};
+    std::mutex _idle_mutex{};
+    std::condition_variable _idle{};
+  };
+
+}  // namespace adv_sk
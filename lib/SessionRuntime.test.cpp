@@ -0,0 +1,284 @@
+// SessionRuntime unit tests
+
+#include "SessionRuntime.hpp"
+
+#include "ActionJournal.hpp"  // for ActionJournal
+#include "ActionScript.hpp"   // for parse_script, ScriptStep
+#include "IInputHandler.hpp"  // for Action
+#include "Map.hpp"            // for create_map
+#include "MockPlayer.hpp"     // for MockPlayer
+#include "Player.hpp"         // for Player
+#include "SessionMap.hpp"     // for SessionMap, SharedWorld
+#include "Simulator.hpp"      // for Simulator, OutputMode
+#include "gmock/gmock.h"      // for NiceMock, Return, Throw
+#include "gtest/gtest.h"      // for TEST, EXPECT_EQ
+
+#include <algorithm>   // for max
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <filesystem>  // for temp_directory_path, remove, exists
+#include <memory>      // for make_unique
+#include <stdexcept>   // for out_of_range, logic_error
+#include <string>      // for string
+#include <thread>      // for yield
+#include <utility>     // for move
+#include <vector>      // for vector
+
+#include <unistd.h>  // for pipe, read, close
+
+namespace adv_sk::test {
+
+  using ::testing::_;
+  using ::testing::NiceMock;
+  using ::testing::Return;
+  using ::testing::Throw;
+
+  namespace {
+    constexpr auto WELCOME =
+        "You are in the Grand Hall. It is a vast, echoing chamber.\n";
+
+    std::uint64_t total_steps(const SessionRuntime& runtime) {
+      std::uint64_t steps = 0;
+      for (const auto& worker : runtime.worker_stats()) {
+        steps += worker.steps;
+      }
+      return steps;
+    }
+  }  // namespace
+
+  TEST(SessionRuntime, runsSubmittedActionsInOrder) {
+    SessionRuntime runtime(2, true);
+    const auto session =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+
+    runtime.submit(session, parse_script("investigate; take golden chalice"));
+    runtime.submit(session, parse_script("inventory"));
+    runtime.wait_idle();
+
+    EXPECT_EQ(runtime.transcript(session),
+              std::string(WELCOME) +
+                  "Investigating GrandHall\n"
+                  "You search the room. You found a golden chalice!\n\n"
+                  "What do you want to take?\n"
+                  "You take the golden chalice\n\n"
+                  "Your inventory contains: golden chalice.\n\n");
+    EXPECT_FALSE(runtime.finished(session));
+  }
+
+  TEST(SessionRuntime, quitFinishesSessionAndDropsTheRest) {
+    SessionRuntime runtime(1, true);
+    const auto session =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+
+    EXPECT_TRUE(runtime.submit(session, parse_script("quit; inventory")));
+    runtime.wait_idle();
+
+    EXPECT_TRUE(runtime.finished(session));
+    EXPECT_EQ(runtime.transcript(session), WELCOME);
+    EXPECT_FALSE(runtime.submit(session, parse_script("inventory")));
+    EXPECT_EQ(total_steps(runtime), 1);
+  }
+
+  TEST(SessionRuntime, throwingActionFinishesOnlyItsSession) {
+    auto map = create_map();
+    const auto hall = map->find_room("GrandHall").value();
+    auto player = std::make_unique<NiceMock<MockPlayer>>();
+    ON_CALL(*player, get_current_room()).WillByDefault(Return(hall));
+    EXPECT_CALL(*player, change_room(_))
+        .WillOnce(Return())
+        .WillRepeatedly(Throw(std::out_of_range("Lost the way")));
+
+    SessionRuntime runtime(1, true);
+    const auto broken = runtime.add_session(std::move(map), std::move(player));
+    const auto healthy =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+    runtime.submit(broken, parse_script("move North; inventory"));
+    runtime.submit(healthy, parse_script("inventory; quit"));
+    runtime.wait_idle();
+
+    EXPECT_TRUE(runtime.finished(broken));
+    EXPECT_EQ(runtime.error(broken), "Lost the way");
+    EXPECT_EQ(runtime.memory(broken).chunks, 0);
+    EXPECT_FALSE(runtime.submit(broken, parse_script("inventory")));
+    EXPECT_TRUE(runtime.finished(healthy));
+    EXPECT_TRUE(runtime.error(healthy).empty());
+  }
+
+  TEST(SessionRuntime, stepsEverySessionAcrossWorkers) {
+    constexpr std::size_t SESSIONS = 200;
+    const SharedWorld world = create_map();
+    const auto script = parse_script(
+        "investigate; take golden chalice; move North; move South; "
+        "drop golden chalice");
+
+    SessionRuntime runtime(4, true);
+    std::vector<SessionId> sessions;
+    for (std::size_t index = 0; index < SESSIONS; ++index) {
+      sessions.push_back(runtime.add_session(
+          std::make_unique<SessionMap>(world), std::make_unique<Player>()));
+    }
+    for (const auto session : sessions) {
+      runtime.submit(session, script);
+    }
+    runtime.wait_idle();
+
+    EXPECT_EQ(total_steps(runtime), SESSIONS * script.size());
+    EXPECT_EQ(runtime.worker_count(), 4);
+    for (const auto session : sessions) {
+      EXPECT_NE(runtime.transcript(session).find("You take the golden"),
+                std::string::npos);
+    }
+  }
+
+  TEST(SessionRuntime, sharedWorldSessionsUseTheirArena) {
+    SessionRuntime runtime(1, true);
+    const auto session = runtime.add_session(SharedWorld(create_map()));
+
+    runtime.submit(session, parse_script("investigate; take golden chalice"));
+    runtime.wait_idle();
+    const auto playing = runtime.memory(session);
+    EXPECT_GT(playing.allocations, 0);
+    EXPECT_GT(playing.bytes_in_use, 0);
+    EXPECT_GT(playing.chunks, 0);
+
+    runtime.submit(session, parse_script("quit"));
+    runtime.wait_idle();
+    const auto finished = runtime.memory(session);
+    EXPECT_EQ(finished.bytes_in_use, 0);
+    EXPECT_EQ(finished.chunks, 0);
+    EXPECT_NE(runtime.transcript(session).find("You take the golden chalice"),
+              std::string::npos);
+  }
+
+  TEST(SessionRuntime, memoryCanBeReadWhileTheSessionRuns) {
+    SessionRuntime runtime(1, true);
+    const auto session = runtime.add_session(SharedWorld(create_map()));
+    const auto round = parse_script(
+        "investigate; take golden chalice; drop golden chalice");
+    for (int rounds = 0; rounds < 200; ++rounds) {
+      runtime.submit(session, round);
+    }
+
+    // Reads race the worker's writes, which is fine for relaxed counters.
+    std::size_t peak = 0;
+    for (int reads = 0; reads < 10000; ++reads) {
+      peak = std::max(peak, runtime.memory(session).peak_bytes_in_use);
+    }
+    runtime.wait_idle();
+    EXPECT_GE(runtime.memory(session).peak_bytes_in_use, peak);
+  }
+
+  TEST(SessionRuntime, attachedOutputGetsTheSessionsMessages) {
+    std::array<int, 2> pipe_ends{};
+    ASSERT_EQ(::pipe(pipe_ends.data()), 0);
+    std::string written;
+    {
+      SessionRuntime runtime(2, true);
+      const auto session =
+          runtime.add_session(create_map(), std::make_unique<Player>());
+      runtime.attach_output(session, pipe_ends[1]);
+
+      runtime.submit(session, parse_script("investigate; inventory"));
+      runtime.wait_idle();
+      runtime.flush_output(session);
+
+      const auto stats = runtime.output_stats(session);
+      EXPECT_EQ(stats.pushed, 3);
+      EXPECT_EQ(stats.depth, 0);
+      written.resize(stats.bytes_written);
+      ASSERT_EQ(::read(pipe_ends[0], written.data(), written.size()),
+                static_cast<ssize_t>(written.size()));
+      // The welcome was sent before the output was attached.
+      EXPECT_EQ(WELCOME + written, runtime.transcript(session));
+    }
+    close(pipe_ends[0]);
+    close(pipe_ends[1]);
+  }
+
+  TEST(SessionRuntime, journalReplaysTheSession) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "adv_sk_runtime_journal.test";
+    SessionRuntime runtime(2, true);
+    const auto session = runtime.add_session(SharedWorld(create_map()));
+    runtime.record_journal(session, path);
+
+    const auto script = parse_script(
+        "investigate; take golden chalice; move North; inventory; quit");
+    runtime.submit(session, script);
+    runtime.wait_idle();
+
+    const auto journal = ActionJournal::load(path);
+    std::filesystem::remove(path);
+    EXPECT_EQ(journal.steps(), script);
+    Simulator replay([] { return create_map(); }, journal.steps(),
+                     OutputMode::Collect);
+    static_cast<void>(replay.run(1));
+    EXPECT_EQ(replay.transcript(), runtime.transcript(session));
+  }
+
+  TEST(SessionRuntime, journalOnlyStartsOnAnIdleSession) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "adv_sk_late_journal.test";
+    SessionRuntime runtime(1);
+    const auto session =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+    runtime.submit(session, parse_script("quit"));
+    runtime.wait_idle();
+
+    EXPECT_THROW(runtime.record_journal(session, path), std::logic_error);
+    EXPECT_FALSE(std::filesystem::exists(path));
+  }
+
+  TEST(SessionRuntime, singleWorkerNeverSteals) {
+    SessionRuntime runtime(1);
+    const auto session =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+    runtime.submit(session, ScriptStep{.action = Action::DisplayInventory});
+    runtime.wait_idle();
+
+    const auto stats = runtime.worker_stats();
+    ASSERT_EQ(stats.size(), 1);
+    EXPECT_EQ(stats[0].steps, 1);
+    EXPECT_EQ(stats[0].steals, 0);
+    EXPECT_GE(stats[0].utilisation, 0.0);
+    EXPECT_LE(stats[0].utilisation, 1.0);
+  }
+
+  TEST(SessionRuntime, busySessionDoesNotStarveOthers) {
+    constexpr std::size_t ACTIONS = 200'000;
+    SessionRuntime runtime(1);
+    const auto busy =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+    const auto quick =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+
+    const std::vector<ScriptStep> inventory(
+        ACTIONS, ScriptStep{.action = Action::DisplayInventory});
+    runtime.submit(busy, inventory);
+    runtime.submit(quick, parse_script("quit"));
+    while (!runtime.finished(quick)) {
+      std::this_thread::yield();
+    }
+
+    // Queued behind the busy session, the quit would come after all of it.
+    EXPECT_LT(total_steps(runtime), ACTIONS);
+    runtime.wait_idle();
+    EXPECT_EQ(total_steps(runtime), ACTIONS + 1);
+  }
+
+  TEST(SessionRuntime, stopRejectsFurtherActions) {
+    SessionRuntime runtime(2);
+    const auto session =
+        runtime.add_session(create_map(), std::make_unique<Player>());
+    runtime.stop();
+    EXPECT_FALSE(runtime.submit(session, parse_script("inventory")));
+    runtime.wait_idle();
+  }
+
+  TEST(SessionRuntime, unknownSessionThrows) {
+    SessionRuntime runtime(1);
+    EXPECT_THROW(static_cast<void>(runtime.finished(7)), std::out_of_range);
+  }
+
+}  // namespace adv_sk::test
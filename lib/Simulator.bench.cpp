@@ -0,0 +1,62 @@
+// Simulator benchmarks
+
+#include "Simulator.hpp"
+
+#include "ActionScript.hpp"       // for parse_script
+#include "BenchmarkSupport.hpp"   // for MIN_ROOMS, MAX_ROOMS
+#include "Map.hpp"                // for create_map
+#include "SessionMap.hpp"         // for SessionMap, SharedWorld
+#include "WorldGenerator.hpp"     // for generate_map, GeneratorOptions
+#include "benchmark/benchmark.h"  // for State, BENCHMARK, Counter
+
+#include <cstddef>  // for size_t
+#include <memory>   // for make_unique
+
+namespace adv_sk::bench {
+
+  namespace {
+    constexpr auto SAMPLE_SESSION =
+        "investigate; take golden chalice; move North; investigate;"
+        "take rusty sword; inventory; move South; drop rusty sword;"
+        "use golden chalice; investigate";
+
+    void BM_SimulateSampleSessions(benchmark::State& state) {
+      Simulator simulator([] { return create_map(); },
+                          parse_script(SAMPLE_SESSION),
+                          static_cast<OutputMode>(state.range(0)));
+      std::size_t actions = 0;
+      for (auto _ : state) {
+        actions += simulator.run(1).actions;
+      }
+      state.counters["sessions/s"] = benchmark::Counter(
+          static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+      state.counters["actions/s"] = benchmark::Counter(
+          static_cast<double>(actions), benchmark::Counter::kIsRate);
+    }
+    BENCHMARK(BM_SimulateSampleSessions)
+        ->Arg(static_cast<int>(OutputMode::Discard))
+        ->Arg(static_cast<int>(OutputMode::Collect))
+        ->ArgName("collect");
+
+    // Sessions overlay one generated world instead of each building their
+    // own, so the cost per session should not depend on the world size.
+    void BM_SimulateOnSharedWorld(benchmark::State& state) {
+      const SharedWorld world = generate_map(GeneratorOptions{
+          .room_count = static_cast<std::size_t>(state.range(0))});
+      Simulator simulator(
+          [&world] { return std::make_unique<SessionMap>(world); },
+          parse_script("investigate; take item0; move North; move East;"
+                       "investigate; drop item0; inventory"));
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(simulator.run(1));
+      }
+      state.counters["sessions/s"] = benchmark::Counter(
+          static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+    BENCHMARK(BM_SimulateOnSharedWorld)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS)
+        ->ArgName("rooms");
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,70 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "Simulator.hpp"
+
+#include "Game.hpp"                  // for BasicGame
+#include "HeadlessInputHandler.hpp"  // for HeadlessInputHandler
+#include "IMap.hpp"                  // for IMap
+#include "Player.hpp"                // for Player
+
+#include <chrono>   // for steady_clock, duration
+#include <cstddef>  // for size_t
+#include <memory>   // for make_unique
+#include <utility>  // for move
+
+namespace adv_sk {
+
+  namespace {
+    double per_second(std::size_t count, std::chrono::nanoseconds elapsed) {
+      const std::chrono::duration<double> seconds = elapsed;
+      if (seconds.count() <= 0.0) {
+        return 0.0;
+      }
+      return static_cast<double>(count) / seconds.count();
+    }
+  }  // namespace
+
+  double SimulationReport::sessions_per_second() const {
+    return per_second(sessions, elapsed);
+  }
+
+  double SimulationReport::actions_per_second() const {
+    return per_second(actions, elapsed);
+  }
+
+  Simulator::Simulator(MapFactory make_map, std::vector<ScriptStep> script,
+                       OutputMode output, std::size_t transcript_capacity)
+      : _make_map(std::move(make_map)),
+        _script(std::move(script)),
+        _output(output) {
+    if (_output == OutputMode::Collect) {
+      _transcript.reserve(transcript_capacity);
+    }
+  }
+
+  SimulationReport Simulator::run(std::size_t sessions) {
+    SimulationReport report{.sessions = sessions};
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t session = 0; session < sessions; ++session) {
+      report.actions += run_session();
+    }
+    report.elapsed = std::chrono::steady_clock::now() - start;
+    return report;
+  }
+
+  std::size_t Simulator::run_session() {
+    _transcript.clear();
+    auto input = std::make_unique<HeadlessInputHandler>(
+        _script, _output == OutputMode::Collect ? &_transcript : nullptr);
+    const auto* handler = input.get();
+
+    // The map is chosen at run time; player and input calls are inlined.
+    BasicGame<IMap, Player, HeadlessInputHandler> game{
+        _make_map(), std::make_unique<Player>(), std::move(input)};
+    game.start();
+    return handler->actions_taken();
+  }
+
+}  // namespace adv_sk
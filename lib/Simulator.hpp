@@ -0,0 +1,69 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "ActionScript.hpp"  // for ScriptStep
+#include "IMap.hpp"          // for IMap
+
+#include <chrono>       // for nanoseconds
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t
+#include <functional>   // for function
+#include <memory>       // for unique_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  enum class OutputMode : std::uint8_t {
+    Discard,
+    Collect,
+  };
+
+  struct SimulationReport {
+    std::size_t sessions{0};
+    std::size_t actions{0};
+    std::chrono::nanoseconds elapsed{0};
+
+    [[nodiscard]] double sessions_per_second() const;
+    [[nodiscard]] double actions_per_second() const;
+  };
+
+  /**
+   * @brief Headless batch runner for scripted play sessions.
+   *
+   * Every session gets a fresh world from the map factory and a fresh
+   * Player, then plays the whole script through Game::handle_user_action.
+   * No console I/O happens: with OutputMode::Collect the messages of the
+   * latest session go into a transcript buffer reserved once up front.
+   */
+  class Simulator {
+   public:
+    using MapFactory = std::function<std::unique_ptr<IMap>()>;
+
+    static constexpr std::size_t DEFAULT_TRANSCRIPT_CAPACITY = 64 * 1024;
+
+    Simulator(MapFactory make_map, std::vector<ScriptStep> script,
+              OutputMode output = OutputMode::Discard,
+              std::size_t transcript_capacity = DEFAULT_TRANSCRIPT_CAPACITY);
+
+    SimulationReport run(std::size_t sessions);
+
+    /// Messages of the most recent session; empty when discarding output.
+    [[nodiscard]] std::string_view transcript() const {
+      return _transcript;
+    }
+
+   private:
+    std::size_t run_session();
+
+    MapFactory _make_map;
+    std::vector<ScriptStep> _script;
+    OutputMode _output;
+    std::string _transcript{};
+  };
+
+}  // namespace adv_sk
@@ -0,0 +1,53 @@
+// Simulator unit tests
+
+#include "Simulator.hpp"
+
+#include "ActionScript.hpp"  // for parse_script
+#include "Map.hpp"           // for create_map
+#include "gtest/gtest.h"     // for TEST, EXPECT_EQ
+
+#include <string>  // for string
+
+namespace adv_sk::test {
+
+  TEST(Simulator, playsScriptOnFreshWorldEverySession) {
+    Simulator simulator(
+        [] { return create_map(); },
+        parse_script("investigate; take golden chalice; move North"),
+        OutputMode::Collect);
+
+    const auto report = simulator.run(3);
+    EXPECT_EQ(report.sessions, 3);
+    EXPECT_EQ(report.actions, 9);
+    // The chalice is back in GrandHall for every session.
+    EXPECT_NE(simulator.transcript().find("You take the golden chalice"),
+              std::string::npos);
+    EXPECT_NE(simulator.transcript().find("You are in the Armoury"),
+              std::string::npos);
+  }
+
+  TEST(Simulator, transcriptHoldsOnlyLatestSession) {
+    Simulator simulator([] { return create_map(); }, parse_script("inventory"),
+                        OutputMode::Collect);
+    static_cast<void>(simulator.run(2));
+    EXPECT_EQ(simulator.transcript(),
+              "You are in the Grand Hall. It is a vast, echoing chamber.\n"
+              "Your inventory contains:.\n\n");
+  }
+
+  TEST(Simulator, quitEndsSessionEarly) {
+    Simulator simulator([] { return create_map(); },
+                        parse_script("inventory; quit; investigate"));
+    const auto report = simulator.run(1);
+    EXPECT_EQ(report.actions, 2);
+    EXPECT_TRUE(simulator.transcript().empty());
+  }
+
+  TEST(Simulator, reportsThroughput) {
+    const SimulationReport report{
+        .sessions = 10, .actions = 100, .elapsed = std::chrono::seconds(2)};
+    EXPECT_DOUBLE_EQ(report.sessions_per_second(), 5.0);
+    EXPECT_DOUBLE_EQ(report.actions_per_second(), 50.0);
+  }
+
+}  // namespace adv_sk::test
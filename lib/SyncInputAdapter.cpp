@@ -0,0 +1,37 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "SyncInputAdapter.hpp"
+
+namespace adv_sk {
+
+  Task<Action> SyncInputAdapter::get_action() {
+    co_return _input->get_action();
+  }
+
+  void SyncInputAdapter::provide_directions(DirectionSet directions) {
+    _input->provide_directions(directions);
+  }
+
+  Task<std::optional<Direction>> SyncInputAdapter::get_direction() {
+    co_return _input->get_direction();
+  }
+
+  Task<std::string> SyncInputAdapter::get_item_name() {
+    co_return _input->get_item_name();
+  }
+
+  Task<std::string> SyncInputAdapter::get_room_name() {
+    co_return _input->get_room_name();
+  }
+
+  void SyncInputAdapter::provide_message(std::string_view message) {
+    _input->provide_message(message);
+  }
+
+  void SyncInputAdapter::provide_prompt(std::string_view prompt) {
+    _input->provide_prompt(prompt);
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,44 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"           // for Direction, DirectionSet
+#include "IAsyncInputHandler.hpp"  // for IAsyncInputHandler
+#include "IInputHandler.hpp"       // for IInputHandler, Action
+#include "Task.hpp"                // for Task
+
+#include <memory>       // for unique_ptr
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+namespace adv_sk {
+
+  /**
+   * @brief Runs a synchronous IInputHandler behind the coroutine interface.
+   *
+   * Every read calls straight through and completes without suspending,
+   * so console handlers and gmock mocks drive Game::run() unchanged.
+   */
+  class SyncInputAdapter : public IAsyncInputHandler {
+   public:
+    explicit SyncInputAdapter(std::unique_ptr<IInputHandler> input)
+        : _input(std::move(input)) {
+    }
+
+    Task<Action> get_action() override;
+    void provide_directions(DirectionSet directions) override;
+    Task<std::optional<Direction>> get_direction() override;
+    Task<std::string> get_item_name() override;
+    Task<std::string> get_room_name() override;
+    void provide_message(std::string_view message) override;
+    void provide_prompt(std::string_view prompt) override;
+
+   private:
+    std::unique_ptr<IInputHandler> _input;
+  };
+
+}  // namespace adv_sk
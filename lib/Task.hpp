@@ -0,0 +1,201 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include <coroutine>    // for coroutine_handle, suspend_always
+#include <exception>    // for exception_ptr, current_exception
+#include <optional>     // for optional
+#include <stdexcept>    // for logic_error
+#include <utility>      // for exchange, move
+
+namespace adv_sk {
+
+  template <typename T>
+  class Task;
+
+  namespace detail {
+    /// Bookkeeping shared by Task<T> and Task<void> promises.
+    class TaskPromiseBase {
+     public:
+      /// Resumes whoever awaited the task, or returns to resume()'s caller.
+      struct FinalAwaiter {
+        [[nodiscard]] bool await_ready() const noexcept {
+          return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(
+            std::coroutine_handle<Promise> finished) noexcept {
+          if (const auto next = finished.promise()._continuation) {
+            return next;
+          }
+          return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {
+        }
+      };
+
+      [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+        return {};
+      }
+
+      [[nodiscard]] FinalAwaiter final_suspend() const noexcept {
+        return {};
+      }
+
+      void unhandled_exception() noexcept {
+        _error = std::current_exception();
+      }
+
+      void set_continuation(std::coroutine_handle<> continuation) noexcept {
+        _continuation = continuation;
+      }
+
+     protected:
+      void rethrow_if_failed() const {
+        if (_error) {
+          std::rethrow_exception(_error);
+        }
+      }
+
+     private:
+      std::coroutine_handle<> _continuation{};
+      std::exception_ptr _error{};
+    };
+
+    template <typename T>
+    class TaskPromise : public TaskPromiseBase {
+     public:
+      Task<T> get_return_object() noexcept;
+
+      void return_value(T value) {
+        _value.emplace(std::move(value));
+      }
+
+      T take_result() {
+        rethrow_if_failed();
+        return std::move(*_value);
+      }
+
+     private:
+      std::optional<T> _value{};
+    };
+
+    template <>
+    class TaskPromise<void> : public TaskPromiseBase {
+     public:
+      Task<void> get_return_object() noexcept;
+
+      void return_void() const noexcept {
+      }
+
+      void take_result() const {
+        rethrow_if_failed();
+      }
+    };
+  }  // namespace detail
+
+  /**
+   * @brief Lazily started coroutine producing a T.
+   *
+   * A Task does nothing until it is either co_awaited, which runs it and
+   * resumes the awaiter when it finishes, or resume()d by a driver at the
+   * top of a chain. Completion hands control straight back to the awaiter,
+   * so chains of nested tasks neither grow the stack nor need a scheduler.
+   * Exceptions thrown in the body are rethrown at the await or result().
+   */
+  template <typename T = void>
+  class [[nodiscard]] Task {
+   public:
+    using promise_type = detail::TaskPromise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task() = default;
+
+    explicit Task(Handle handle) noexcept : _handle(handle) {
+    }
+
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {
+    }
+
+    Task& operator=(Task&& other) noexcept {
+      if (this != &other) {
+        destroy();
+        _handle = std::exchange(other._handle, {});
+      }
+      return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+      destroy();
+    }
+
+    [[nodiscard]] bool valid() const noexcept {
+      return static_cast<bool>(_handle);
+    }
+
+    [[nodiscard]] bool done() const noexcept {
+      return !_handle || _handle.done();
+    }
+
+    /// Runs the task until it first suspends or finishes.
+    void resume() const {
+      if (!done()) {
+        _handle.resume();
+      }
+    }
+
+    /// The outcome of a finished task; rethrows its exception if it failed.
+    T result() {
+      if (!_handle || !_handle.done()) {
+        throw std::logic_error("Task has not finished");
+      }
+      return _handle.promise().take_result();
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept {
+      return done();
+    }
+
+    std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<> awaiter) noexcept {
+      _handle.promise().set_continuation(awaiter);
+      return _handle;
+    }
+
+    /// Awaiting an empty task throws std::logic_error, as result() does.
+    T await_resume() {
+      if (!_handle) {
+        throw std::logic_error("Task is empty");
+      }
+      return _handle.promise().take_result();
+    }
+
+   private:
+    void destroy() noexcept {
+      if (_handle) {
+        _handle.destroy();
+      }
+    }
+
+    Handle _handle{};
+  };
+
+  namespace detail {
+    template <typename T>
+    Task<T> TaskPromise<T>::get_return_object() noexcept {
+      return Task<T>{Task<T>::Handle::from_promise(*this)};
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+      return Task<void>{Task<void>::Handle::from_promise(*this)};
+    }
+  }  // namespace detail
+
+}  // namespace adv_sk
@@ -0,0 +1,107 @@
+// Task unit tests
+
+#include "Task.hpp"
+
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <coroutine>  // for coroutine_handle
+#include <stdexcept>  // for runtime_error, logic_error
+#include <string>     // for string, to_string
+
+namespace adv_sk::test {
+
+  namespace {
+    Task<int> answer() {
+      co_return 42;
+    }
+
+    Task<std::string> describe() {
+      const auto value = co_await answer();
+      co_return "answer " + std::to_string(value);
+    }
+
+    Task<int> fail() {
+      throw std::runtime_error("boom");
+      co_return 0;
+    }
+
+    /// Suspends until resumed by hand, like input that has not arrived yet.
+    struct Gate {
+      [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<> waiting) noexcept {
+        parked = waiting;
+      }
+
+      void await_resume() const noexcept {
+      }
+
+      std::coroutine_handle<> parked{};
+    };
+
+    Task<int> wait_at(Gate& gate) {
+      co_await gate;
+      co_return 7;
+    }
+
+    Task<> add_after_gate(Gate& gate, int& total) {
+      total += co_await wait_at(gate);
+    }
+
+    Task<> await_empty() {
+      co_await Task<>{};
+    }
+  }  // namespace
+
+  TEST(Task, isLazyUntilResumed) {
+    auto task = answer();
+    EXPECT_TRUE(task.valid());
+    EXPECT_FALSE(task.done());
+    EXPECT_THROW(static_cast<void>(task.result()), std::logic_error);
+    task.resume();
+    ASSERT_TRUE(task.done());
+    EXPECT_EQ(task.result(), 42);
+  }
+
+  TEST(Task, awaitsNestedTasks) {
+    auto task = describe();
+    task.resume();
+    EXPECT_EQ(task.result(), "answer 42");
+  }
+
+  TEST(Task, rethrowsExceptionFromBody) {
+    auto task = fail();
+    task.resume();
+    ASSERT_TRUE(task.done());
+    EXPECT_THROW(static_cast<void>(task.result()), std::runtime_error);
+  }
+
+  TEST(Task, resumingInnerAwaitContinuesOuterTask) {
+    Gate gate;
+    int total = 0;
+    auto task = add_after_gate(gate, total);
+    task.resume();
+    EXPECT_FALSE(task.done());
+    ASSERT_TRUE(gate.parked);
+
+    gate.parked.resume();
+    EXPECT_TRUE(task.done());
+    EXPECT_EQ(total, 7);
+  }
+
+  TEST(Task, defaultTaskIsDone) {
+    const Task<> task;
+    EXPECT_FALSE(task.valid());
+    EXPECT_TRUE(task.done());
+  }
+
+  TEST(Task, awaitingEmptyTaskThrows) {
+    auto task = await_empty();
+    task.resume();
+    ASSERT_TRUE(task.done());
+    EXPECT_THROW(task.result(), std::logic_error);
+  }
+
+}  // namespace adv_sk::test
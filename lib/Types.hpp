@@ -1,9 +1,16 @@
 #pragma once
 
-#include <string>  // for string
+#include <cstdint>  // for uint32_t
+#include <limits>   // for numeric_limits
+#include <string>   // for string
 
 namespace adv_sk {
 
   using RoomName = std::string;
 
+  /// Dense index of a room, assigned by Map when the room name is interned.
+  using RoomId = std::uint32_t;
+
+  inline constexpr RoomId INVALID_ROOM_ID = std::numeric_limits<RoomId>::max();
+
 }  // namespace adv_sk
@@ -0,0 +1,33 @@
+// WorldGenerator benchmarks
+
+#include "WorldGenerator.hpp"
+
+#include "BenchmarkSupport.hpp"   // for MIN_ROOMS, MAX_ROOMS
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>  // for size_t
+
+namespace adv_sk::bench {
+
+  namespace {
+    void BM_GenerateMap(benchmark::State& state) {
+      const GeneratorOptions options{
+          .topology = static_cast<Topology>(state.range(0)),
+          .room_count = static_cast<std::size_t>(state.range(1))};
+      for (auto _ : state) {
+        auto map = generate_map(options);
+        benchmark::DoNotOptimize(map->size());
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK(BM_GenerateMap)
+        ->ArgsProduct({{static_cast<int>(Topology::Grid),
+                        static_cast<int>(Topology::Maze),
+                        static_cast<int>(Topology::RandomGraph),
+                        static_cast<int>(Topology::HubAndSpoke)},
+                       {MIN_ROOMS, 1'000, 100'000, MAX_ROOMS}})
+        ->ArgNames({"topology", "rooms"})
+        ->Unit(benchmark::kMillisecond);
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,409 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "WorldGenerator.hpp"
+
+#include "Direction.hpp"  // for Direction, ALL_DIRECTIONS, opposite_...
+#include "Inventory.hpp"  // for InventoryItem, ItemDefinition, make_items
+#include "Room.hpp"       // for Room
+#include "Types.hpp"      // for RoomId, RoomName
+
+#include <array>        // for array
+#include <cmath>        // for ceil, sqrt
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <cstdint>      // for uint64_t
+#include <memory>       // for make_unique
+#include <mutex>        // for mutex, lock_guard
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <utility>      // for move, swap
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  namespace {
+    constexpr std::size_t SPOKE_LENGTH = 8;
+    constexpr std::string_view MESSAGE_FILLER =
+        " Dust hangs in the still air and old stones line the walls.";
+
+    /// SplitMix64: tiny, fast and identical on every standard library.
+    class Random {
+     public:
+      explicit Random(std::uint64_t seed) : _state(seed) {
+      }
+
+      std::uint64_t next() {
+        std::uint64_t value = (_state += 0x9E3779B97F4A7C15ULL);
+        value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31U);
+      }
+
+      std::size_t below(std::size_t bound) {
+        return static_cast<std::size_t>(next() % bound);
+      }
+
+      double unit() {
+        constexpr double SCALE = 1.0 / static_cast<double>(1ULL << 53U);
+        return static_cast<double>(next() >> 11U) * SCALE;
+      }
+
+     private:
+      std::uint64_t _state;
+    };
+
+    RoomName room_name(std::size_t index) {
+      return index == 0 ? RoomName("GrandHall")
+                        : "Room" + std::to_string(index);
+    }
+
+    /// Writes into `message`, which the caller reuses for every room.
+    std::string_view room_message(const RoomName& name, std::size_t length,
+                                  std::string& message) {
+      message.assign("You are in ").append(name).append(".");
+      while (message.size() < length) {
+        message.append(MESSAGE_FILLER);
+      }
+      message.resize(length);
+      return message;
+    }
+
+    /**
+     * @brief "item0", "item1" and on, the items every generated world uses.
+     *
+     * They are the same definitions in every world, so each is interned
+     * once per process, in one batch, and later worlds take their ids from
+     * here without building a name or searching the catalog.
+     */
+    std::vector<InventoryItem> numbered_items(std::size_t count) {
+      static std::mutex mutex;
+      static std::vector<InventoryItem> items;
+      const std::lock_guard lock(mutex);
+      if (items.size() < count) {
+        std::vector<ItemDefinition> definitions;
+        definitions.reserve(count - items.size());
+        for (auto number = items.size(); number < count; ++number) {
+          definitions.push_back(
+              ItemDefinition{.name = "item" + std::to_string(number)});
+        }
+        const auto added = make_items(definitions);
+        items.insert(items.end(), added.begin(), added.end());
+      }
+      return {items.begin(),
+              items.begin() + static_cast<std::ptrdiff_t>(count)};
+    }
+
+    /**
+     * @brief Every room's exits, indexed by RoomId.
+     *
+     * The topologies are built here rather than on the rooms: a room takes
+     * a cache line of exits instead of four, so the random links of a maze
+     * or random graph stay in a table a twelfth the size, and each room is
+     * then built with its exits in one sequential pass.
+     */
+    using Exits = std::vector<RoomConnections>;
+
+    /// Links both ways; callers make sure both exit slots are free.
+    void link(Exits& exits, RoomId from, Direction direction, RoomId to) {
+      exits[from].add(direction, to);
+      exits[to].add(opposite_direction(direction), from);
+    }
+
+    std::vector<Room> make_rooms(const GeneratorOptions& options,
+                                 const Exits& exits, Random& random) {
+      const auto whole_items = static_cast<std::size_t>(options.item_density);
+      const auto extra_item_chance =
+          options.item_density - static_cast<double>(whole_items);
+      std::vector<std::size_t> item_counts(options.room_count, whole_items);
+      std::size_t total_items = 0;
+      for (auto& item_count : item_counts) {
+        if (random.unit() < extra_item_chance) {
+          ++item_count;
+        }
+        total_items += item_count;
+      }
+      const auto items = numbered_items(total_items);
+
+      std::vector<Room> rooms;
+      rooms.reserve(options.room_count);
+      std::string message;
+      message.reserve(options.message_length + MESSAGE_FILLER.size());
+      auto next_item = items.begin();
+      for (std::size_t index = 0; index < options.room_count; ++index) {
+        const auto name = room_name(index);
+        auto& room = rooms.emplace_back(
+            name, room_message(name, options.message_length, message),
+            std::vector<InventoryItem>{}, exits[index]);
+        for (std::size_t item = 0; item < item_counts[index]; ++item) {
+          room.add_to_inventory(*next_item++);
+        }
+      }
+      return rooms;
+    }
+
+    /// Rooms laid out row by row, East along a row and North between rows.
+    struct GridShape {
+      explicit GridShape(std::size_t room_count)
+          : room_count(room_count),
+            width(static_cast<std::size_t>(
+                std::ceil(std::sqrt(static_cast<double>(room_count))))) {
+      }
+
+      [[nodiscard]] bool has_east(std::size_t room) const {
+        return (room % width) + 1 < width && room + 1 < room_count;
+      }
+
+      [[nodiscard]] bool has_north(std::size_t room) const {
+        return room + width < room_count;
+      }
+
+      std::size_t room_count;
+      std::size_t width;
+    };
+
+    void build_grid(Exits& exits) {
+      const GridShape grid(exits.size());
+      for (RoomId room = 0; room < exits.size(); ++room) {
+        if (grid.has_east(room)) {
+          link(exits, room, Direction::East, room + 1);
+        }
+        if (grid.has_north(room)) {
+          link(exits, room, Direction::North,
+               static_cast<RoomId>(room + grid.width));
+        }
+      }
+    }
+
+    class DisjointSets {
+     public:
+      explicit DisjointSets(std::size_t size) : _parent(size) {
+        for (RoomId room = 0; room < size; ++room) {
+          _parent[room] = room;
+        }
+      }
+
+      RoomId find(RoomId room) {
+        while (_parent[room] != room) {
+          _parent[room] = _parent[_parent[room]];
+          room = _parent[room];
+        }
+        return room;
+      }
+
+      bool unite(RoomId first, RoomId second) {
+        first = find(first);
+        second = find(second);
+        if (first == second) {
+          return false;
+        }
+        _parent[second] = first;
+        return true;
+      }
+
+     private:
+      std::vector<RoomId> _parent;
+    };
+
+    /// Randomised Kruskal over the grid edges.
+    void build_maze(Exits& exits, Random& random) {
+      const GridShape grid(exits.size());
+      struct Edge {
+        RoomId from;
+        Direction direction;
+      };
+      std::vector<Edge> edges;
+      edges.reserve(exits.size() * 2);
+      for (RoomId room = 0; room < exits.size(); ++room) {
+        if (grid.has_east(room)) {
+          edges.push_back({room, Direction::East});
+        }
+        if (grid.has_north(room)) {
+          edges.push_back({room, Direction::North});
+        }
+      }
+      for (auto index = edges.size(); index > 1; --index) {
+        std::swap(edges[index - 1], edges[random.below(index)]);
+      }
+
+      // The edges come in random order; the kept ones are noted per room
+      // and linked afterwards in room order, close to where they lead.
+      const auto target = [&grid](RoomId from, Direction direction) {
+        return static_cast<RoomId>(
+            direction == Direction::East ? from + 1 : from + grid.width);
+      };
+      DisjointSets components(exits.size());
+      std::vector<DirectionMask> kept(exits.size());
+      for (const auto& [from, direction] : edges) {
+        if (components.unite(from, target(from, direction))) {
+          kept[from] = static_cast<DirectionMask>(kept[from] |
+                                                  direction_bit(direction));
+        }
+      }
+      for (RoomId room = 0; room < exits.size(); ++room) {
+        for (const auto direction : DirectionSet(kept[room])) {
+          link(exits, room, direction, target(room, direction));
+        }
+      }
+    }
+
+    /// The exits that face those in `mask` from the rooms they lead to.
+    DirectionMask mirrored(DirectionMask mask) {
+      static const auto MIRRORS = [] {
+        std::array<DirectionMask, std::size_t{1} << DIRECTION_COUNT> mirrors{};
+        for (std::size_t bits = 0; bits < mirrors.size(); ++bits) {
+          for (const auto direction :
+               DirectionSet(static_cast<DirectionMask>(bits))) {
+            mirrors[bits] = static_cast<DirectionMask>(
+                mirrors[bits] | direction_bit(opposite_direction(direction)));
+          }
+        }
+        return mirrors;
+      }();
+      return MIRRORS[mask];
+    }
+
+    /**
+     * @brief Rooms that still have a free exit, with O(1) random pick and
+     * removal.
+     *
+     * Each entry keeps its room's free exits, so choosing a link reads
+     * nothing but the two entries.
+     */
+    class OpenRooms {
+     public:
+      explicit OpenRooms(std::size_t capacity) {
+        _rooms.reserve(capacity);
+      }
+
+      /// A room with every exit still free.
+      void add(RoomId room) {
+        _rooms.push_back({room, ALL_EXITS});
+      }
+
+      [[nodiscard]] std::size_t size() const {
+        return _rooms.size();
+      }
+
+      [[nodiscard]] std::size_t pick(Random& random) const {
+        return random.below(_rooms.size());
+      }
+
+      /// Links two entries' rooms through a random exit free in both;
+      /// false if there is none.
+      bool link_random(Exits& exits, std::size_t from, std::size_t to,
+                       Random& random) {
+        auto& first = _rooms[from];
+        auto& second = _rooms[to];
+        const DirectionSet both(
+            static_cast<DirectionMask>(first.free & mirrored(second.free)));
+        if (both.empty()) {
+          return false;
+        }
+        auto chosen = both.begin();
+        for (auto skip = random.below(both.size()); skip > 0; --skip) {
+          ++chosen;
+        }
+        const auto direction = *chosen;
+        link(exits, first.room, direction, second.room);
+        first.free = static_cast<DirectionMask>(first.free &
+                                                ~direction_bit(direction));
+        second.free = static_cast<DirectionMask>(
+            second.free & ~direction_bit(opposite_direction(direction)));
+        return true;
+      }
+
+      /// Swap-removes the entry at `index` once its room has no free exit.
+      void drop_if_full(std::size_t index) {
+        if (_rooms[index].free == 0) {
+          _rooms[index] = _rooms.back();
+          _rooms.pop_back();
+        }
+      }
+
+     private:
+      static constexpr auto ALL_EXITS = static_cast<DirectionMask>(
+          (std::size_t{1} << DIRECTION_COUNT) - 1);
+
+      struct Entry {
+        RoomId room;
+        DirectionMask free;
+      };
+
+      std::vector<Entry> _rooms;
+    };
+
+    void build_random_graph(Exits& exits, double extra_edge_ratio,
+                            Random& random) {
+      if (exits.size() < 2) {
+        return;
+      }
+      // Spanning tree first: every new room hangs off a random earlier room
+      // that still has a free exit. A new room has every exit free, so any
+      // open partner works.
+      OpenRooms open(exits.size());
+      open.add(0);
+      for (RoomId room = 1; room < exits.size(); ++room) {
+        const auto partner = open.pick(random);
+        open.add(room);
+        open.link_random(exits, open.size() - 1, partner, random);
+        // Only the partner can have filled up; the new room is left with
+        // free exits.
+        open.drop_if_full(partner);
+      }
+
+      const auto extra_edges = static_cast<std::size_t>(
+          extra_edge_ratio * static_cast<double>(exits.size()));
+      for (std::size_t edge = 0; edge < extra_edges && open.size() > 1;
+           ++edge) {
+        const auto first = open.pick(random);
+        const auto second = open.pick(random);
+        if (first == second ||
+            !open.link_random(exits, first, second, random)) {
+          continue;
+        }
+        // Drop the higher index first so the lower one stays valid.
+        open.drop_if_full(first > second ? first : second);
+        open.drop_if_full(first > second ? second : first);
+      }
+    }
+
+    void build_hub_and_spoke(Exits& exits) {
+      constexpr std::size_t CLUSTER_SIZE = 1 + (2 * SPOKE_LENGTH);
+      for (RoomId room = 1; room < exits.size(); ++room) {
+        const auto offset = room % CLUSTER_SIZE;
+        const auto hub = static_cast<RoomId>(room - offset);
+        if (offset == 0) {
+          link(exits, static_cast<RoomId>(room - CLUSTER_SIZE),
+               Direction::East, room);
+        } else if (offset <= SPOKE_LENGTH) {
+          link(exits, offset == 1 ? hub : room - 1, Direction::North, room);
+        } else {
+          link(exits, offset == SPOKE_LENGTH + 1 ? hub : room - 1,
+               Direction::South, room);
+        }
+      }
+    }
+  }  // namespace
+
+  std::unique_ptr<Map> generate_map(const GeneratorOptions& options) {
+    Random random(options.seed);
+    Exits exits(options.room_count);
+    switch (options.topology) {
+      case Topology::Grid:
+        build_grid(exits);
+        break;
+      case Topology::Maze:
+        build_maze(exits, random);
+        break;
+      case Topology::RandomGraph:
+        build_random_graph(exits, options.extra_edge_ratio, random);
+        break;
+      case Topology::HubAndSpoke:
+        build_hub_and_spoke(exits);
+        break;
+    }
+    return std::make_unique<Map>(make_rooms(options, exits, random));
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,48 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Map.hpp"  // for Map
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t, uint64_t
+#include <memory>   // for unique_ptr
+
+namespace adv_sk {
+
+  enum class Topology : std::uint8_t {
+    /// Every room is linked to all of its grid neighbours.
+    Grid,
+    /// Random spanning tree of the grid: exactly one path between two rooms.
+    Maze,
+    /// Random spanning tree plus random extra edges between free exits.
+    RandomGraph,
+    /// East-west backbone of hubs, each with a North and a South spoke.
+    HubAndSpoke,
+  };
+
+  struct GeneratorOptions {
+    Topology topology{Topology::Grid};
+    std::size_t room_count{100};
+    /// Average number of items per room; the fraction is rolled per room.
+    double item_density{0.5};
+    /// Exact length of every room's welcome message.
+    std::size_t message_length{64};
+    /// RandomGraph only: extra edges to try, relative to the room count.
+    double extra_edge_ratio{0.5};
+    std::uint64_t seed{0};
+  };
+
+  /**
+   * @brief Generates a world for scale testing.
+   *
+   * Output depends only on the options: the same seed gives the same world
+   * on every platform. Room 0 is always "GrandHall", the others are named
+   * "Room<id>", and every exit has a matching exit back. Rooms are linked by
+   * RoomId directly, so no name lookups happen during generation.
+   */
+  std::unique_ptr<Map> generate_map(const GeneratorOptions& options);
+
+}  // namespace adv_sk
@@ -0,0 +1,140 @@
+// WorldGenerator unit tests
+
+#include "WorldGenerator.hpp"
+
+#include "Direction.hpp"  // for ALL_DIRECTIONS, opposite_direction
+#include "Map.hpp"        // for Map
+#include "Room.hpp"       // for Room
+#include "Types.hpp"      // for RoomId
+#include "gtest/gtest.h"  // for TEST, EXPECT_EQ
+
+#include <array>     // for array
+#include <cstddef>   // for size_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <queue>     // for queue
+#include <vector>    // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    constexpr std::array<Topology, 4> ALL_TOPOLOGIES{
+        Topology::Grid, Topology::Maze, Topology::RandomGraph,
+        Topology::HubAndSpoke};
+
+    std::size_t count_exits(Map& map) {
+      std::size_t exits = 0;
+      for (RoomId room = 0; room < map.size(); ++room) {
+        exits += map.get_room(room).connections().size();
+      }
+      return exits;
+    }
+
+    std::size_t count_reachable(Map& map) {
+      std::vector<bool> seen(map.size(), false);
+      std::queue<RoomId> frontier;
+      frontier.push(0);
+      seen[0] = true;
+      std::size_t reached = 0;
+      while (!frontier.empty()) {
+        const auto room = frontier.front();
+        frontier.pop();
+        ++reached;
+        for (const auto direction : map.available_exits(room)) {
+          // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+          const auto next = map.next_room(room, direction).value();
+          if (!seen[next]) {
+            seen[next] = true;
+            frontier.push(next);
+          }
+        }
+      }
+      return reached;
+    }
+  }  // namespace
+
+  TEST(WorldGenerator, everyTopologyHasReciprocalConnections) {
+    for (const auto topology : ALL_TOPOLOGIES) {
+      auto map = generate_map({.topology = topology, .room_count = 500});
+      ASSERT_EQ(map->size(), 500);
+      for (RoomId room = 0; room < map->size(); ++room) {
+        for (const auto direction : map->available_exits(room)) {
+          // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+          const auto next = map->next_room(room, direction).value();
+          EXPECT_EQ(map->next_room(next, opposite_direction(direction)),
+                    std::optional<RoomId>(room));
+        }
+      }
+    }
+  }
+
+  TEST(WorldGenerator, everyTopologyIsConnected) {
+    for (const auto topology : ALL_TOPOLOGIES) {
+      auto map = generate_map({.topology = topology, .room_count = 777});
+      EXPECT_EQ(count_reachable(*map), map->size());
+    }
+  }
+
+  TEST(WorldGenerator, mazeIsASpanningTree) {
+    auto map = generate_map({.topology = Topology::Maze, .room_count = 1000});
+    EXPECT_EQ(count_exits(*map), 2 * (map->size() - 1));
+  }
+
+  TEST(WorldGenerator, gridLinksAllNeighbours) {
+    auto map = generate_map({.topology = Topology::Grid, .room_count = 9});
+    // 3x3 grid: 6 east-west and 6 north-south links, each stored twice.
+    EXPECT_EQ(count_exits(*map), 24);
+    EXPECT_EQ(map->available_exits(4).size(), 4);
+  }
+
+  TEST(WorldGenerator, startsAtGrandHallWithNamedRooms) {
+    auto map = generate_map({.room_count = 3});
+    EXPECT_EQ(map->find_room("GrandHall"), std::optional<RoomId>(0));
+    EXPECT_EQ(map->find_room("Room2"), std::optional<RoomId>(2));
+  }
+
+  TEST(WorldGenerator, messagesHaveRequestedLength) {
+    auto map = generate_map({.room_count = 20, .message_length = 200});
+    for (RoomId room = 0; room < map->size(); ++room) {
+      EXPECT_EQ(map->get_welcome_message(room).size(), 200);
+    }
+  }
+
+  TEST(WorldGenerator, itemDensityIsAverageItemsPerRoom) {
+    auto map = generate_map({.room_count = 10000, .item_density = 2.5});
+    std::size_t items = 0;
+    for (RoomId room = 0; room < map->size(); ++room) {
+      items += map->get_room(room).inventory().size();
+    }
+    EXPECT_NEAR(static_cast<double>(items) / 10000.0, 2.5, 0.05);
+  }
+
+  TEST(WorldGenerator, sameSeedGivesSameWorld) {
+    for (const auto topology : ALL_TOPOLOGIES) {
+      const GeneratorOptions options{
+          .topology = topology, .room_count = 300, .seed = 42};
+      auto first = generate_map(options);
+      auto second = generate_map(options);
+      for (RoomId room = 0; room < first->size(); ++room) {
+        EXPECT_EQ(first->get_room(room).connections().targets,
+                  second->get_room(room).connections().targets);
+        EXPECT_EQ(first->get_room(room).inventory().size(),
+                  second->get_room(room).inventory().size());
+      }
+    }
+  }
+
+  TEST(WorldGenerator, differentSeedGivesDifferentMaze) {
+    auto first = generate_map(
+        {.topology = Topology::Maze, .room_count = 300, .seed = 1});
+    auto second = generate_map(
+        {.topology = Topology::Maze, .room_count = 300, .seed = 2});
+    bool differs = false;
+    for (RoomId room = 0; room < first->size() && !differs; ++room) {
+      differs = first->get_room(room).connections().targets !=
+                second->get_room(room).connections().targets;
+    }
+    EXPECT_TRUE(differs);
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,94 @@
+// WorldImage benchmarks
+
+#include "WorldImage.hpp"
+
+#include "BenchmarkSupport.hpp"   // for MIN_ROOMS, MAX_ROOMS
+#include "Direction.hpp"          // for Direction
+#include "ImageMap.hpp"           // for ImageMap
+#include "Types.hpp"              // for RoomId
+#include "WorldGenerator.hpp"     // for generate_map, GeneratorOptions
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>     // for size_t
+#include <filesystem>  // for path, temp_directory_path, remove
+#include <fstream>     // for ofstream
+#include <string>      // for to_string
+
+namespace adv_sk::bench {
+
+  namespace {
+    /// A compiled grid world on disk, removed again when done.
+    class ImageFile {
+     public:
+      explicit ImageFile(std::size_t room_count)
+          : _path(std::filesystem::temp_directory_path() /
+                  ("adv_sk_bench_" + std::to_string(room_count) +
+                   ".advworld")) {
+        std::ofstream out(_path, std::ios::binary | std::ios::trunc);
+        write_world_image(
+            *generate_map(GeneratorOptions{.room_count = room_count}), out);
+      }
+
+      ImageFile(const ImageFile&) = delete;
+      ImageFile& operator=(const ImageFile&) = delete;
+      ImageFile(ImageFile&&) = delete;
+      ImageFile& operator=(ImageFile&&) = delete;
+
+      ~ImageFile() {
+        std::filesystem::remove(_path);
+      }
+
+      [[nodiscard]] const std::filesystem::path& path() const {
+        return _path;
+      }
+
+     private:
+      std::filesystem::path _path;
+    };
+
+    void BM_WorldImageOpen(benchmark::State& state) {
+      const ImageFile file(static_cast<std::size_t>(state.range(0)));
+      for (auto _ : state) {
+        const auto image = WorldImage::open(file.path());
+        benchmark::DoNotOptimize(image->room_count());
+      }
+      state.counters["bytes"] =
+          static_cast<double>(std::filesystem::file_size(file.path()));
+    }
+    BENCHMARK(BM_WorldImageOpen)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS)
+        ->Unit(benchmark::kMicrosecond);
+
+    void BM_ImageMapNextRoomById(benchmark::State& state) {
+      const ImageFile file(static_cast<std::size_t>(state.range(0)));
+      ImageMap map(WorldImage::open(file.path()));
+      RoomId room = 0;
+      for (auto _ : state) {
+        room = map.next_room(room, Direction::East).value_or(0);
+        benchmark::DoNotOptimize(room);
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ImageMapNextRoomById)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS);
+
+    void BM_ImageMapFindRoom(benchmark::State& state) {
+      const auto room_count = static_cast<std::size_t>(state.range(0));
+      const ImageFile file(room_count);
+      const auto image = WorldImage::open(file.path());
+      std::size_t index = 0;
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(image->find_room(image->room_name(
+            static_cast<RoomId>(index))));
+        index = index + 1 == room_count ? 0 : index + 1;
+      }
+      state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ImageMapFindRoom)
+        ->RangeMultiplier(10)
+        ->Range(MIN_ROOMS, MAX_ROOMS);
+  }  // namespace
+
+}  // namespace adv_sk::bench
@@ -0,0 +1,330 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "WorldImage.hpp"
+
+#include "Inventory.hpp"  // for InventoryItem
+#include "Types.hpp"      // for RoomId, INVALID_ROOM_ID
+
+#include <algorithm>      // for max
+#include <bit>            // for bit_ceil, has_single_bit
+#include <cstring>        // for memcmp
+#include <sstream>        // for ostringstream
+#include <stdexcept>      // for runtime_error
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+
+#include <fcntl.h>     // for open, O_RDONLY
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+
+namespace adv_sk {
+
+  namespace image {
+    std::uint64_t hash_name(std::string_view name) {
+      constexpr std::uint64_t FNV_OFFSET = 0xCBF29CE484222325ULL;
+      constexpr std::uint64_t FNV_PRIME = 0x100000001B3ULL;
+      std::uint64_t hash = FNV_OFFSET;
+      for (const auto character : name) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= FNV_PRIME;
+      }
+      return hash;
+    }
+  }  // namespace image
+
+  namespace {
+    constexpr std::size_t ALIGNMENT = 8;
+    constexpr std::size_t MIN_NAME_SLOTS = 16;
+
+    constexpr std::uint64_t align_up(std::uint64_t offset) {
+      return (offset + ALIGNMENT - 1) & ~std::uint64_t{ALIGNMENT - 1};
+    }
+
+    [[noreturn]] void bad_image(const std::string& reason) {
+      throw std::runtime_error("Invalid world image: " + reason);
+    }
+
+    /// Collects the tables of an image in memory before writing them out.
+    class ImageBuilder {
+     public:
+      explicit ImageBuilder(const Map& map) {
+        const auto room_count = map.size();
+        _rooms.reserve(room_count);
+        _exits.reserve(room_count * DIRECTION_COUNT);
+        for (RoomId room = 0; room < room_count; ++room) {
+          add_room(map.get_room(room));
+        }
+        build_name_index(map);
+      }
+
+      void write(std::ostream& out) const {
+        image::Header header{
+            .room_count = _rooms.size(),
+            .item_count = _items.size(),
+            .name_index_size = _name_index.size(),
+            .string_pool_size = _strings.size(),
+        };
+        header.rooms_offset = align_up(sizeof(image::Header));
+        header.exits_offset =
+            align_up(header.rooms_offset + bytes_of(_rooms));
+        header.items_offset =
+            align_up(header.exits_offset + bytes_of(_exits));
+        header.name_index_offset =
+            align_up(header.items_offset + bytes_of(_items));
+        header.strings_offset =
+            align_up(header.name_index_offset + bytes_of(_name_index));
+
+        std::uint64_t written = 0;
+        const auto put = [&](const void* data, std::uint64_t size) {
+          out.write(static_cast<const char*>(data),
+                    static_cast<std::streamsize>(size));
+          written += size;
+        };
+        const auto pad_to = [&](std::uint64_t offset) {
+          constexpr std::array<char, ALIGNMENT> ZEROS{};
+          put(ZEROS.data(), offset - written);
+        };
+
+        put(&header, sizeof(header));
+        pad_to(header.rooms_offset);
+        put(_rooms.data(), bytes_of(_rooms));
+        pad_to(header.exits_offset);
+        put(_exits.data(), bytes_of(_exits));
+        pad_to(header.items_offset);
+        put(_items.data(), bytes_of(_items));
+        pad_to(header.name_index_offset);
+        put(_name_index.data(), bytes_of(_name_index));
+        pad_to(header.strings_offset);
+        put(_strings.data(), _strings.size());
+        if (!out) {
+          throw std::runtime_error("Failed to write world image");
+        }
+      }
+
+     private:
+      template <typename T>
+      static std::uint64_t bytes_of(const std::vector<T>& table) {
+        return table.size() * sizeof(T);
+      }
+
+      void add_room(const Room& room) {
+        image::RoomRecord record{
+            .name = intern(room.get_name()),
+            .message = intern(room.get_message()),
+            .first_item = _items.size(),
+            .item_count = static_cast<std::uint32_t>(room.inventory().size()),
+            .exits = room.connections().exits,
+        };
+        for (const auto& item : room.inventory()) {
+          _items.push_back({intern(item.name()), intern(item.use_message())});
+        }
+        const auto& targets = room.connections().targets;
+        _exits.insert(_exits.end(), targets.begin(), targets.end());
+        _rooms.push_back(record);
+      }
+
+      /// Appends `text` to the pool once and reuses it for repeats.
+      image::StringRef intern(std::string_view text) {
+        const auto [entry, inserted] =
+            _pooled.try_emplace(text, image::StringRef{});
+        if (inserted) {
+          entry->second = {.offset = _strings.size(), .length = text.size()};
+          _strings.append(text);
+        }
+        return entry->second;
+      }
+
+      void build_name_index(const Map& map) {
+        _name_index.assign(
+            std::bit_ceil(std::max(MIN_NAME_SLOTS, _rooms.size() * 2)),
+            INVALID_ROOM_ID);
+        const auto mask = _name_index.size() - 1;
+        for (RoomId room = 0; room < _rooms.size(); ++room) {
+          auto slot = image::hash_name(map.get_room_name(room)) & mask;
+          while (_name_index[slot] != INVALID_ROOM_ID) {
+            slot = (slot + 1) & mask;
+          }
+          _name_index[slot] = room;
+        }
+      }
+
+      std::vector<image::RoomRecord> _rooms{};
+      std::vector<RoomId> _exits{};
+      std::vector<image::ItemRecord> _items{};
+      std::vector<RoomId> _name_index{};
+      std::string _strings{};
+      /// Views into `map`, which outlives the builder.
+      std::unordered_map<std::string_view, image::StringRef> _pooled{};
+    };
+
+    /// The table of `count` Ts at `offset`, after checking it fits.
+    template <typename T>
+    std::span<const T> table_at(std::span<const std::byte> bytes,
+                                std::uint64_t offset, std::uint64_t count,
+                                const char* name) {
+      if (offset % alignof(T) != 0 || offset > bytes.size() ||
+          count > (bytes.size() - offset) / sizeof(T)) {
+        bad_image(std::string(name) + " table out of bounds");
+      }
+      return {reinterpret_cast<const T*>(bytes.data() + offset),
+              static_cast<std::size_t>(count)};
+    }
+  }  // namespace
+
+  void write_world_image(const Map& map, std::ostream& out) {
+    ImageBuilder(map).write(out);
+  }
+
+  std::vector<std::byte> compile_world_image(const Map& map) {
+    std::ostringstream out(std::ios::binary);
+    write_world_image(map, out);
+    const auto text = std::move(out).str();
+    const auto* data = reinterpret_cast<const std::byte*>(text.data());
+    return {data, data + text.size()};
+  }
+
+  /// Keeps the image bytes alive: either a file mapping or a buffer.
+  struct WorldImage::Mapping {
+    Mapping() = default;
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+    Mapping(Mapping&&) = delete;
+    Mapping& operator=(Mapping&&) = delete;
+
+    ~Mapping() {
+      if (address != nullptr) {
+        munmap(address, length);
+      }
+    }
+
+    void* address{nullptr};
+    std::size_t length{0};
+    std::vector<std::byte> buffer{};
+  };
+
+  WorldImage::WorldImage(std::span<const std::byte> bytes,
+                         std::unique_ptr<Mapping> owner)
+      : _owner(std::move(owner)) {
+    if (bytes.size() < sizeof(image::Header)) {
+      bad_image("file too small");
+    }
+    const auto& header =
+        *reinterpret_cast<const image::Header*>(bytes.data());
+    if (header.magic != image::MAGIC) {
+      bad_image("bad magic");
+    }
+    if (header.byte_order != image::BYTE_ORDER_MARK) {
+      bad_image("byte order differs from this machine");
+    }
+    if (header.version != image::VERSION) {
+      bad_image("unsupported version " + std::to_string(header.version));
+    }
+    if (header.direction_count != DIRECTION_COUNT) {
+      bad_image("compiled for a different set of directions");
+    }
+    if (header.room_count >= INVALID_ROOM_ID ||
+        (header.room_count > 0 &&
+         (header.name_index_size <= header.room_count ||
+          !std::has_single_bit(header.name_index_size)))) {
+      bad_image("bad room count or name index size");
+    }
+
+    _rooms = table_at<image::RoomRecord>(bytes, header.rooms_offset,
+                                         header.room_count, "room");
+    _exits = table_at<RoomId>(bytes, header.exits_offset,
+                              header.room_count * DIRECTION_COUNT, "exit");
+    _items = table_at<image::ItemRecord>(bytes, header.items_offset,
+                                         header.item_count, "item");
+    _name_index = table_at<RoomId>(bytes, header.name_index_offset,
+                                   header.name_index_size, "name index");
+    const auto strings = table_at<char>(bytes, header.strings_offset,
+                                        header.string_pool_size, "string");
+    _strings = std::string_view(strings.data(), strings.size());
+  }
+
+  WorldImage::~WorldImage() = default;
+
+  std::shared_ptr<const WorldImage> WorldImage::open(
+      const std::filesystem::path& path) {
+    const int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+      throw std::runtime_error("Cannot open world image: " + path.string());
+    }
+    struct stat status {};
+    if (fstat(file, &status) != 0) {
+      close(file);
+      throw std::runtime_error("Cannot stat world image: " + path.string());
+    }
+
+    auto mapping = std::make_unique<Mapping>();
+    mapping->length = static_cast<std::size_t>(status.st_size);
+    if (mapping->length > 0) {
+      void* address = mmap(nullptr, mapping->length, PROT_READ, MAP_SHARED,
+                           file, 0);
+      if (address == MAP_FAILED) {
+        close(file);
+        throw std::runtime_error("Cannot map world image: " + path.string());
+      }
+      mapping->address = address;
+    }
+    close(file);
+
+    const std::span<const std::byte> bytes(
+        static_cast<const std::byte*>(mapping->address), mapping->length);
+    return std::shared_ptr<const WorldImage>(
+        new WorldImage(bytes, std::move(mapping)));
+  }
+
+  std::shared_ptr<const WorldImage> WorldImage::from_bytes(
+      std::vector<std::byte> bytes) {
+    auto owner = std::make_unique<Mapping>();
+    owner->buffer = std::move(bytes);
+    const std::span<const std::byte> view(owner->buffer);
+    return std::shared_ptr<const WorldImage>(
+        new WorldImage(view, std::move(owner)));
+  }
+
+  void WorldImage::corrupt(const char* reason) {
+    bad_image(reason);
+  }
+
+  std::optional<RoomId> WorldImage::find_room(std::string_view name) const {
+    const auto mask = _name_index.size() - 1;
+    auto slot = image::hash_name(name) & mask;
+    // A sound index always has a free slot; a corrupt one may have none.
+    for (std::size_t probes = 0; probes < _name_index.size(); ++probes) {
+      const auto room = _name_index[slot];
+      if (room == INVALID_ROOM_ID) {
+        return std::nullopt;
+      }
+      if (room >= _rooms.size()) {
+        corrupt("name index entry out of range");
+      }
+      if (room_name(room) == name) {
+        return room;
+      }
+      slot = (slot + 1) & mask;
+    }
+    return std::nullopt;
+  }
+
+  Room WorldImage::make_room(RoomId room) const {
+    std::vector<InventoryItem> items;
+    items.reserve(item_count(room));
+    for (std::size_t index = 0; index < item_count(room); ++index) {
+      const auto [name, use_message] = item(room, index);
+      items.emplace_back(name, use_message);
+    }
+    RoomConnections connections;
+    for (const auto direction : exits(room)) {
+      connections.add(direction, exit_target(room, direction));
+    }
+    return Room(room_name(room), room_message(room), std::move(items),
+                connections);
+  }
+
+}  // namespace adv_sk
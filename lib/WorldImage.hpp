@@ -0,0 +1,191 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"  // for Direction, DirectionSet, DIRECTION_COUNT
+#include "Map.hpp"        // for Map
+#include "Room.hpp"       // for Room
+#include "Types.hpp"      // for RoomId, INVALID_ROOM_ID
+
+#include <array>        // for array
+#include <cstddef>      // for size_t, byte
+#include <cstdint>      // for uint32_t, uint64_t
+#include <filesystem>   // for path
+#include <memory>       // for shared_ptr
+#include <optional>     // for optional
+#include <ostream>      // for ostream
+#include <span>         // for span
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  /**
+   * On-disk layout of a compiled world, version 1.
+   *
+   * All integers are little-endian and every table starts 8-byte aligned:
+   * Header, RoomRecord[room_count], RoomId[room_count * DIRECTION_COUNT]
+   * adjacency, ItemRecord[item_count], RoomId[name_index_size] name index
+   * and finally the string pool. The name index is open addressing with
+   * linear probing on FNV-1a of the name, so lookups need no setup.
+   */
+  namespace image {
+    inline constexpr std::array<char, 8> MAGIC{'A', 'D', 'V', 'W',
+                                               'O', 'R', 'L', 'D'};
+    inline constexpr std::uint32_t VERSION = 1;
+    inline constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    struct Header {
+      std::array<char, 8> magic{MAGIC};
+      std::uint32_t version{VERSION};
+      std::uint32_t byte_order{BYTE_ORDER_MARK};
+      std::uint32_t direction_count{DIRECTION_COUNT};
+      std::uint32_t reserved{0};
+      std::uint64_t room_count{0};
+      std::uint64_t item_count{0};
+      std::uint64_t name_index_size{0};
+      std::uint64_t string_pool_size{0};
+      std::uint64_t rooms_offset{0};
+      std::uint64_t exits_offset{0};
+      std::uint64_t items_offset{0};
+      std::uint64_t name_index_offset{0};
+      std::uint64_t strings_offset{0};
+    };
+
+    /// A slice of the string pool.
+    struct StringRef {
+      std::uint64_t offset{0};
+      std::uint64_t length{0};
+    };
+
+    struct RoomRecord {
+      StringRef name{};
+      StringRef message{};
+      std::uint64_t first_item{0};
+      std::uint32_t item_count{0};
+      std::uint32_t exits{0};
+    };
+
+    struct ItemRecord {
+      StringRef name{};
+      StringRef use_message{};
+    };
+
+    std::uint64_t hash_name(std::string_view name);
+  }  // namespace image
+
+  /// Writes `map` as a world image; this is what the offline compiler runs.
+  void write_world_image(const Map& map, std::ostream& out);
+
+  /// The image write_world_image() would write, in memory.
+  std::vector<std::byte> compile_world_image(const Map& map);
+
+  /**
+   * @brief Read-only view of a compiled world image.
+   *
+   * open() maps the file read-only and shared, checks the header and table
+   * extents, and is then done: queries read the tables in place, so opening
+   * costs the same for any world size and processes mapping the same file
+   * share its pages. Throws std::runtime_error for files that are not a
+   * compatible image.
+   *
+   * The records themselves are checked as they are read: an exit target,
+   * item range, name index entry or string outside its table throws
+   * std::runtime_error from the query that reads it. Room ids passed in
+   * must be below room_count().
+   */
+  class WorldImage {
+   public:
+    struct ItemView {
+      std::string_view name;
+      std::string_view use_message;
+    };
+
+    static std::shared_ptr<const WorldImage> open(
+        const std::filesystem::path& path);
+
+    /// Takes an image already in memory, e.g. freshly compiled.
+    static std::shared_ptr<const WorldImage> from_bytes(
+        std::vector<std::byte> bytes);
+
+    ~WorldImage();
+
+    WorldImage(const WorldImage&) = delete;
+    WorldImage& operator=(const WorldImage&) = delete;
+    WorldImage(WorldImage&&) = delete;
+    WorldImage& operator=(WorldImage&&) = delete;
+
+    [[nodiscard]] std::size_t room_count() const {
+      return _rooms.size();
+    }
+
+    [[nodiscard]] std::optional<RoomId> find_room(std::string_view name) const;
+
+    [[nodiscard]] std::string_view room_name(RoomId room) const {
+      return string(_rooms[room].name);
+    }
+
+    [[nodiscard]] std::string_view room_message(RoomId room) const {
+      return string(_rooms[room].message);
+    }
+
+    /// Target of the exit, or INVALID_ROOM_ID when there is none.
+    [[nodiscard]] RoomId exit_target(RoomId room, Direction direction) const {
+      const auto target =
+          _exits[(room * DIRECTION_COUNT) + direction_index(direction)];
+      if (target >= _rooms.size() && target != INVALID_ROOM_ID) {
+        corrupt("exit target out of range");
+      }
+      return target;
+    }
+
+    [[nodiscard]] DirectionSet exits(RoomId room) const {
+      return DirectionSet(static_cast<DirectionMask>(_rooms[room].exits));
+    }
+
+    [[nodiscard]] std::size_t item_count(RoomId room) const {
+      return _rooms[room].item_count;
+    }
+
+    [[nodiscard]] ItemView item(RoomId room, std::size_t index) const {
+      const auto first = _rooms[room].first_item;
+      if (first > _items.size() || index >= _items.size() - first) {
+        corrupt("item out of range");
+      }
+      const auto& record = _items[first + index];
+      return {string(record.name), string(record.use_message)};
+    }
+
+    /// Copies one room, with items and exits, out of the image.
+    [[nodiscard]] Room make_room(RoomId room) const;
+
+   private:
+    struct Mapping;
+
+    WorldImage(std::span<const std::byte> bytes,
+               std::unique_ptr<Mapping> owner);
+
+    [[nodiscard]] std::string_view string(image::StringRef ref) const {
+      if (ref.offset > _strings.size() ||
+          ref.length > _strings.size() - ref.offset) {
+        corrupt("string out of range");
+      }
+      return _strings.substr(ref.offset, ref.length);
+    }
+
+    /// Throws std::runtime_error for a record pointing outside its table.
+    [[noreturn]] static void corrupt(const char* reason);
+
+    std::unique_ptr<Mapping> _owner;
+    std::span<const image::RoomRecord> _rooms{};
+    std::span<const RoomId> _exits{};
+    std::span<const image::ItemRecord> _items{};
+    std::span<const RoomId> _name_index{};
+    std::string_view _strings{};
+  };
+
+  using SharedWorldImage = std::shared_ptr<const WorldImage>;
+
+}  // namespace adv_sk
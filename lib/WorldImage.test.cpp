@@ -0,0 +1,189 @@
+// WorldImage unit tests
+
+#include "WorldImage.hpp"
+
+#include "Direction.hpp"       // for ALL_DIRECTIONS, direction_index
+#include "Map.hpp"             // for Map, create_map
+#include "Room.hpp"            // for Room
+#include "Types.hpp"           // for RoomId
+#include "WorldGenerator.hpp"  // for generate_map, GeneratorOptions
+#include "WorldText.hpp"       // for parse_world
+#include "gtest/gtest.h"       // for TEST, EXPECT_EQ
+
+#include <algorithm>    // for equal
+#include <cstddef>      // for byte, size_t, offsetof
+#include <cstdint>      // for uint64_t
+#include <cstring>      // for memcpy
+#include <filesystem>   // for path, temp_directory_path, remove
+#include <fstream>      // for ofstream
+#include <optional>     // for nullopt
+#include <stdexcept>    // for runtime_error
+#include <string_view>  // for string_view
+#include <utility>      // for as_const
+#include <vector>       // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    void expect_same_world(const Map& map, const WorldImage& image) {
+      ASSERT_EQ(image.room_count(), map.size());
+      for (RoomId room = 0; room < map.size(); ++room) {
+        const auto& expected = map.get_room(room);
+        EXPECT_EQ(image.room_name(room), expected.get_name());
+        EXPECT_EQ(image.room_message(room), expected.get_message());
+        EXPECT_EQ(image.find_room(image.room_name(room)), room);
+        EXPECT_EQ(image.exits(room), expected.connections().directions());
+        for (const auto direction : ALL_DIRECTIONS) {
+          EXPECT_EQ(image.exit_target(room, direction),
+                    expected.connections().target(direction));
+        }
+        ASSERT_EQ(image.item_count(room), expected.inventory().size());
+        for (std::size_t item = 0; item < image.item_count(room); ++item) {
+          EXPECT_EQ(image.item(room, item).name,
+                    expected.inventory()[item].name());
+          EXPECT_EQ(image.item(room, item).use_message,
+                    expected.inventory()[item].use_message());
+        }
+      }
+    }
+
+    std::vector<std::byte> starter_image() {
+      return compile_world_image(*create_map());
+    }
+
+    image::Header header_of(const std::vector<std::byte>& bytes) {
+      image::Header header;
+      std::memcpy(&header, bytes.data(), sizeof(header));
+      return header;
+    }
+
+    template <typename T>
+    void poke(std::vector<std::byte>& bytes, std::uint64_t offset, T value) {
+      std::memcpy(bytes.data() + offset, &value, sizeof(value));
+    }
+  }  // namespace
+
+  TEST(WorldImage, roundTripsStarterWorld) {
+    const auto map = create_map();
+    const auto image = WorldImage::from_bytes(compile_world_image(*map));
+    expect_same_world(*map, *image);
+    EXPECT_FALSE(image->find_room("Attic").has_value());
+  }
+
+  TEST(WorldImage, roundTripsGeneratedWorld) {
+    const auto map = generate_map(GeneratorOptions{
+        .topology = Topology::RandomGraph, .room_count = 2'000, .seed = 3});
+    const auto image = WorldImage::from_bytes(compile_world_image(*map));
+    expect_same_world(*map, *image);
+  }
+
+  TEST(WorldImage, makeRoomCopiesRoomOutOfImage) {
+    const auto map = create_map();
+    const auto image = WorldImage::from_bytes(compile_world_image(*map));
+    const auto room = image->make_room(0);
+    const auto& expected = std::as_const(*map).get_room(0);
+    EXPECT_EQ(room.get_name(), expected.get_name());
+    EXPECT_EQ(room.connections().targets, expected.connections().targets);
+    EXPECT_TRUE(std::ranges::equal(room.inventory(), expected.inventory()));
+  }
+
+  TEST(WorldImage, poolsRepeatedStrings) {
+    const auto distinct = compile_world_image(
+        *parse_world("room A\nmessage first\nroom B\nmessage second"));
+    const auto repeated = compile_world_image(
+        *parse_world("room A\nmessage first\nroom B\nmessage first"));
+    EXPECT_EQ(distinct.size() - repeated.size(),
+              std::string_view("second").size());
+  }
+
+  TEST(WorldImage, opensMappedFile) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "adv_sk_world_image.test";
+    {
+      std::ofstream out(path, std::ios::binary | std::ios::trunc);
+      write_world_image(*create_map(), out);
+    }
+    const auto image = WorldImage::open(path);
+    std::filesystem::remove(path);
+
+    expect_same_world(*create_map(), *image);
+  }
+
+  TEST(WorldImage, rejectsMissingFile) {
+    EXPECT_THROW(WorldImage::open("/nonexistent/world.advworld"),
+                 std::runtime_error);
+  }
+
+  TEST(WorldImage, rejectsTruncatedImage) {
+    auto bytes = starter_image();
+    bytes.resize(bytes.size() / 2);
+    EXPECT_THROW(WorldImage::from_bytes(bytes), std::runtime_error);
+    EXPECT_THROW(WorldImage::from_bytes({}), std::runtime_error);
+  }
+
+  TEST(WorldImage, rejectsForeignOrNewerImages) {
+    auto bad_magic = starter_image();
+    bad_magic[0] = std::byte{'X'};
+    EXPECT_THROW(WorldImage::from_bytes(bad_magic), std::runtime_error);
+
+    auto newer = starter_image();
+    newer[offsetof(image::Header, version)] = std::byte{2};
+    EXPECT_THROW(WorldImage::from_bytes(newer), std::runtime_error);
+  }
+
+  TEST(WorldImage, corruptRecordsThrowWhenRead) {
+    const auto sound = starter_image();
+    const auto header = header_of(sound);
+    const auto hall =
+        WorldImage::from_bytes(sound)->find_room("GrandHall").value();
+    const auto record =
+        header.rooms_offset + (hall * sizeof(image::RoomRecord));
+
+    auto exits = sound;
+    poke(exits,
+         header.exits_offset +
+             (((hall * DIRECTION_COUNT) + direction_index(Direction::North)) *
+              sizeof(RoomId)),
+         static_cast<RoomId>(header.room_count));
+    EXPECT_THROW(static_cast<void>(WorldImage::from_bytes(exits)->exit_target(
+                     hall, Direction::North)),
+                 std::runtime_error);
+
+    auto items = sound;
+    poke(items, record + offsetof(image::RoomRecord, first_item),
+         header.item_count);
+    EXPECT_THROW(
+        static_cast<void>(WorldImage::from_bytes(items)->item(hall, 0)),
+        std::runtime_error);
+
+    auto strings = sound;
+    poke(strings,
+         record + offsetof(image::RoomRecord, message) +
+             offsetof(image::StringRef, offset),
+         header.string_pool_size);
+    EXPECT_THROW(
+        static_cast<void>(WorldImage::from_bytes(strings)->room_message(hall)),
+        std::runtime_error);
+
+    auto index = sound;
+    for (std::uint64_t slot = 0; slot < header.name_index_size; ++slot) {
+      poke(index, header.name_index_offset + (slot * sizeof(RoomId)),
+           static_cast<RoomId>(header.room_count));
+    }
+    const auto unindexed = WorldImage::from_bytes(index);
+    EXPECT_THROW(static_cast<void>(unindexed->find_room("GrandHall")),
+                 std::runtime_error);
+  }
+
+  TEST(WorldImage, fullNameIndexStillEndsTheLookup) {
+    auto bytes = starter_image();
+    const auto header = header_of(bytes);
+    for (std::uint64_t slot = 0; slot < header.name_index_size; ++slot) {
+      poke(bytes, header.name_index_offset + (slot * sizeof(RoomId)),
+           RoomId{0});
+    }
+    EXPECT_EQ(WorldImage::from_bytes(bytes)->find_room("Nowhere"),
+              std::nullopt);
+  }
+
+}  // namespace adv_sk::test
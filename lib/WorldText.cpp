@@ -0,0 +1,215 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "WorldText.hpp"
+
+#include "CommandParser.hpp"  // for parse_direction, trim
+#include "Direction.hpp"      // for direction_to_string
+#include "Inventory.hpp"      // for ItemDefinition, make_items
+#include "Room.hpp"           // for Room, NamedConnections
+#include "Types.hpp"          // for RoomName, RoomId
+
+#include <cstddef>        // for size_t
+#include <stdexcept>      // for runtime_error
+#include <string>         // for string, to_string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+namespace adv_sk {
+
+  namespace {
+    constexpr std::string_view WHITESPACE = " \t\r";
+
+    std::string unescape(std::string_view text) {
+      std::string result;
+      result.reserve(text.size());
+      for (std::size_t index = 0; index < text.size(); ++index) {
+        if (text[index] == '\\' && index + 1 < text.size()) {
+          const auto next = text[++index];
+          result.push_back(next == 'n' ? '\n' : next);
+        } else {
+          result.push_back(text[index]);
+        }
+      }
+      return result;
+    }
+
+    std::string escape(std::string_view text) {
+      std::string result;
+      result.reserve(text.size());
+      for (const auto character : text) {
+        if (character == '\n') {
+          result.append("\\n");
+        } else {
+          if (character == '\\') {
+            result.push_back('\\');
+          }
+          result.push_back(character);
+        }
+      }
+      return result;
+    }
+
+    [[noreturn]] void fail(const std::string& reason,
+                           std::size_t line_number) {
+      throw std::runtime_error("World line " + std::to_string(line_number) +
+                               ": " + reason);
+    }
+
+    void require(bool condition, const char* reason,
+                 std::size_t line_number) {
+      if (!condition) {
+        fail(reason, line_number);
+      }
+    }
+
+    WorldDirective parse_exit(std::string_view argument,
+                              std::size_t line_number) {
+      const auto separator = argument.find_first_of(WHITESPACE);
+      require(separator != std::string_view::npos,
+              "exit needs a direction and a room", line_number);
+      const auto direction = parse_direction(argument.substr(0, separator));
+      require(direction.has_value(), "Unknown direction", line_number);
+      return WorldDirective{
+          .kind = WorldDirective::Kind::Exit,
+          .text = std::string(trim(argument.substr(separator))),
+          .direction = direction.value()};
+    }
+
+    /// Rooms as authored, before names are resolved to RoomIds.
+    class WorldBuilder {
+     public:
+      void add_line(std::string_view line, std::size_t line_number) {
+        auto directive = parse_world_line(line, line_number);
+        switch (directive.kind) {
+          case WorldDirective::Kind::None:
+            break;
+          case WorldDirective::Kind::Room:
+            _rooms.push_back(Draft{.name = std::move(directive.text)});
+            break;
+          case WorldDirective::Kind::Message:
+            current_room(line_number).message = std::move(directive.text);
+            break;
+          case WorldDirective::Kind::Item:
+            current_room(line_number)
+                .items.push_back(
+                    ItemDefinition{.name = std::move(directive.text)});
+            break;
+          case WorldDirective::Kind::Use: {
+            auto& items = current_room(line_number).items;
+            require(!items.empty(), "use before any item", line_number);
+            items.back().use_message = std::move(directive.text);
+            break;
+          }
+          case WorldDirective::Kind::Exit:
+            current_room(line_number)
+                .exits.try_emplace(directive.direction,
+                                   std::move(directive.text));
+            break;
+        }
+      }
+
+      WorldSource build() {
+        WorldSource source;
+        source.rooms.reserve(_rooms.size());
+        for (auto& draft : _rooms) {
+          if (!draft.exits.empty()) {
+            source.connections.emplace(draft.name, std::move(draft.exits));
+          }
+          source.rooms.emplace_back(std::move(draft.name),
+                                    std::move(draft.message),
+                                    make_items(draft.items));
+        }
+        return source;
+      }
+
+     private:
+      struct Draft {
+        RoomName name{};
+        std::string message{};
+        std::vector<ItemDefinition> items{};
+        NamedConnections exits{};
+      };
+
+      Draft& current_room(std::size_t line_number) {
+        require(!_rooms.empty(), "directive before any room", line_number);
+        return _rooms.back();
+      }
+
+      std::vector<Draft> _rooms{};
+    };
+  }  // namespace
+
+  WorldDirective parse_world_line(std::string_view line,
+                                  std::size_t line_number) {
+    line = trim(line);
+    if (line.empty() || line.front() == '#') {
+      return {};
+    }
+    const auto separator = line.find_first_of(WHITESPACE);
+    const auto keyword = line.substr(0, separator);
+    const auto argument = separator == std::string_view::npos
+                              ? std::string_view{}
+                              : trim(line.substr(separator));
+
+    if (keyword == "room") {
+      require(!argument.empty(), "room needs a name", line_number);
+      return {.kind = WorldDirective::Kind::Room,
+              .text = std::string(argument)};
+    }
+    if (keyword == "message") {
+      return {.kind = WorldDirective::Kind::Message,
+              .text = unescape(argument)};
+    }
+    if (keyword == "item") {
+      require(!argument.empty(), "item needs a name", line_number);
+      return {.kind = WorldDirective::Kind::Item, .text = unescape(argument)};
+    }
+    if (keyword == "use") {
+      return {.kind = WorldDirective::Kind::Use, .text = unescape(argument)};
+    }
+    if (keyword == "exit") {
+      return parse_exit(argument, line_number);
+    }
+    fail("unknown directive '" + std::string(keyword) + "'", line_number);
+  }
+
+  WorldSource read_world(std::string_view text) {
+    WorldBuilder builder;
+    std::size_t line_number = 0;
+    while (!text.empty()) {
+      const auto end = text.find('\n');
+      builder.add_line(text.substr(0, end), ++line_number);
+      text.remove_prefix(end == std::string_view::npos ? text.size()
+                                                       : end + 1);
+    }
+    return builder.build();
+  }
+
+  std::unique_ptr<Map> parse_world(std::string_view text) {
+    const auto source = read_world(text);
+    return std::make_unique<Map>(source.rooms, source.connections);
+  }
+
+  void write_world_text(const Map& map, std::ostream& out) {
+    for (RoomId room_id = 0; room_id < map.size(); ++room_id) {
+      const auto& room = map.get_room(room_id);
+      out << "room " << room.get_name() << '\n';
+      out << "  message " << escape(room.get_message()) << '\n';
+      for (const auto& item : room.inventory()) {
+        out << "  item " << escape(item.name()) << '\n';
+        if (!item.use_message().empty()) {
+          out << "    use " << escape(item.use_message()) << '\n';
+        }
+      }
+      for (const auto direction : room.connections().directions()) {
+        out << "  exit " << direction_to_string(direction) << ' '
+            << map.get_room_name(room.connections().target(direction))
+            << '\n';
+      }
+    }
+  }
+
+}  // namespace adv_sk
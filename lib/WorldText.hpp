@@ -0,0 +1,88 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"  // for Direction
+#include "Map.hpp"        // for Map
+#include "Room.hpp"       // for Room, NamedConnections
+#include "Types.hpp"      // for RoomName
+
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t
+#include <memory>         // for unique_ptr
+#include <ostream>        // for ostream
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+namespace adv_sk {
+
+  /// One line of the text world format, as read by parse_world_line().
+  struct WorldDirective {
+    enum class Kind : std::uint8_t {
+      /// Blank or comment line.
+      None,
+      Room,
+      Message,
+      Item,
+      Use,
+      Exit,
+    };
+
+    Kind kind{Kind::None};
+    /// Unescaped argument; the target room for Kind::Exit.
+    std::string text{};
+    Direction direction{Direction::North};
+  };
+
+  /**
+   * @brief Parses one line of the text world format on its own.
+   *
+   * Checks everything that can be checked without the surrounding lines;
+   * throws std::runtime_error naming `line_number` otherwise.
+   */
+  WorldDirective parse_world_line(std::string_view line,
+                                  std::size_t line_number);
+
+  /// Rooms and exits as authored, before exit targets are resolved.
+  struct WorldSource {
+    std::vector<Room> rooms{};
+    std::unordered_map<RoomName, NamedConnections> connections{};
+  };
+
+  /**
+   * @brief Reads the format parse_world() takes without building a Map.
+   *
+   * Exits are kept by name, so validate_world() can report the ones that
+   * lead nowhere. Throws std::runtime_error naming the line of a malformed
+   * directive.
+   */
+  WorldSource read_world(std::string_view text);
+
+  /**
+   * @brief Builds a Map from the line-based world description format.
+   *
+   * One directive per line, leading whitespace ignored, '#' starts a
+   * comment line:
+   *
+   *     room GrandHall
+   *       message You are in the Grand Hall.
+   *       item golden chalice
+   *         use You hold the golden chalice aloft.\n
+   *       exit North Armoury
+   *
+   * `message`, `item` and `exit` apply to the latest room and `use` to its
+   * latest item. In text, "\n" stands for a newline and "\\" for a
+   * backslash. Exits are linked both ways, as in the Map constructor.
+   * Throws std::runtime_error naming the line of a malformed directive and
+   * std::out_of_range for an exit to an unknown room.
+   */
+  std::unique_ptr<Map> parse_world(std::string_view text);
+
+  /// Writes `map` in the format parse_world() reads, every exit included.
+  void write_world_text(const Map& map, std::ostream& out);
+
+}  // namespace adv_sk
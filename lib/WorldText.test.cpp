@@ -0,0 +1,115 @@
+// WorldText unit tests
+
+#include "WorldText.hpp"
+
+#include "Direction.hpp"       // for Direction
+#include "Inventory.hpp"       // for InventoryItem
+#include "Map.hpp"             // for Map, create_map
+#include "Types.hpp"           // for RoomId
+#include "WorldGenerator.hpp"  // for generate_map, GeneratorOptions
+#include "WorldValidator.hpp"  // for validate_world, IssueKind
+#include "gtest/gtest.h"       // for TEST, EXPECT_EQ
+
+#include <algorithm>  // for equal
+#include <sstream>    // for ostringstream
+#include <stdexcept>  // for runtime_error, out_of_range
+#include <string>     // for string
+#include <utility>    // for as_const
+
+namespace adv_sk::test {
+
+  namespace {
+    constexpr auto STARTER_WORLD = R"(# The starter world
+room GrandHall
+  message You are in the Grand Hall. It is a vast, echoing chamber.
+  item golden chalice
+    use You hold the golden chalice aloft. It glints in the light and feels cool to the touch.\n
+  exit North Armoury
+
+room Armoury
+  message You are in the Armoury. Racks of dusty weapons line the walls.
+  item rusty sword
+)";
+
+    std::string error_of(const std::string& text) {
+      try {
+        static_cast<void>(parse_world(text));
+      } catch (const std::runtime_error& error) {
+        return error.what();
+      }
+      return {};
+    }
+  }  // namespace
+
+  TEST(WorldText, starterWorldMatchesCreateMap) {
+    const auto parsed = parse_world(STARTER_WORLD);
+    const auto built = create_map();
+    ASSERT_EQ(parsed->size(), built->size());
+    for (RoomId room = 0; room < built->size(); ++room) {
+      const auto& expected = std::as_const(*built).get_room(room);
+      const auto& actual = std::as_const(*parsed).get_room(room);
+      EXPECT_EQ(actual.get_name(), expected.get_name());
+      EXPECT_EQ(actual.get_message(), expected.get_message());
+      EXPECT_EQ(actual.connections().targets,
+                expected.connections().targets);
+      EXPECT_TRUE(std::ranges::equal(actual.inventory(), expected.inventory()));
+    }
+  }
+
+  TEST(WorldText, linksExitsBothWays) {
+    const auto map = parse_world("room A\nexit East B\nroom B\n");
+    EXPECT_EQ(map->next_room("A", Direction::East), "B");
+    EXPECT_EQ(map->next_room("B", Direction::West), "A");
+  }
+
+  TEST(WorldText, unescapesText) {
+    const auto map = parse_world(R"(room A
+message Line one\nLine two \\ done)");
+    EXPECT_EQ(map->get_welcome_message("A"), "Line one\nLine two \\ done");
+  }
+
+  TEST(WorldText, reportsLineOfBadDirective) {
+    EXPECT_EQ(error_of("room A\n\n  teleport B"),
+              "World line 3: unknown directive 'teleport'");
+    EXPECT_EQ(error_of("message Hello"),
+              "World line 1: directive before any room");
+    EXPECT_EQ(error_of("room A\nuse it"), "World line 2: use before any item");
+    EXPECT_EQ(error_of("room A\nexit Up B"),
+              "World line 2: Unknown direction");
+    EXPECT_EQ(error_of("room A\nexit North"),
+              "World line 2: exit needs a direction and a room");
+  }
+
+  TEST(WorldText, writtenWorldParsesBack) {
+    const auto map = generate_map(GeneratorOptions{
+        .topology = Topology::Maze, .room_count = 200, .item_density = 2.0});
+    auto& item = map->get_room(RoomId{0}).inventory().front();
+    item = InventoryItem(item.name(), "Odd \\ text\nover two lines");
+    std::ostringstream text;
+    write_world_text(*map, text);
+
+    const auto parsed = parse_world(text.str());
+    ASSERT_EQ(parsed->size(), map->size());
+    for (RoomId room = 0; room < map->size(); ++room) {
+      const auto& expected = std::as_const(*map).get_room(room);
+      const auto& actual = std::as_const(*parsed).get_room(room);
+      EXPECT_EQ(actual.get_name(), expected.get_name());
+      EXPECT_EQ(actual.get_message(), expected.get_message());
+      EXPECT_EQ(actual.connections().targets,
+                expected.connections().targets);
+      EXPECT_TRUE(std::ranges::equal(actual.inventory(), expected.inventory()));
+    }
+  }
+
+  TEST(WorldText, exitToUnknownRoomThrows) {
+    EXPECT_THROW(parse_world("room A\nexit North Nowhere"), std::out_of_range);
+  }
+
+  TEST(WorldText, readWorldLeavesUnknownRoomsToTheValidator) {
+    const auto source = read_world("room GrandHall\nexit North Nowhere");
+    const auto report = validate_world(source.rooms, source.connections);
+    EXPECT_EQ(report.count(IssueKind::DanglingExit), 1);
+    EXPECT_NE(report.describe().find("Nowhere"), std::string::npos);
+  }
+
+}  // namespace adv_sk::test
@@ -0,0 +1,33 @@
+// WorldValidator benchmarks
+
+#include "WorldValidator.hpp"
+
+#include "BenchmarkSupport.hpp"   // for MAX_ROOMS
+#include "WorldGenerator.hpp"     // for generate_map, GeneratorOptions
+#include "benchmark/benchmark.h"  // for State, BENCHMARK
+
+#include <cstddef>  // for size_t
+
+namespace adv_sk::bench {
+
+  namespace {
+    void BM_ValidateWorld(benchmark::State& state) {
+      const auto map = generate_map(GeneratorOptions{
+          .topology = Topology::RandomGraph,
+          .room_count = static_cast<std::size_t>(state.range(0))});
+      const ValidationOptions options{
+          .threads = static_cast<std::size_t>(state.range(1))};
+      for (auto _ : state) {
+        const auto report = validate_world(*map, options);
+        benchmark::DoNotOptimize(report.reachable_rooms);
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_ValidateWorld)
+        ->ArgsProduct({{1'000, 100'000, MAX_ROOMS}, {1, 4}})
+        ->ArgNames({"rooms", "threads"})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+  }  // namespace
+
+}  // namespace adv_sk::bench
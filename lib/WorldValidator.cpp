@@ -0,0 +1,399 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#include "WorldValidator.hpp"
+
+#include "Direction.hpp"      // for ALL_DIRECTIONS, opposite_direction, ...
+#include "Inventory.hpp"      // for InventoryItem
+#include "RoomNameIndex.hpp"  // for RoomNameIndex
+#include "Types.hpp"          // for RoomId, INVALID_ROOM_ID
+
+#include <algorithm>    // for all_of, find_if, max, min, sort
+#include <array>        // for array
+#include <cstdint>      // for uint8_t
+#include <iterator>     // for back_inserter
+#include <sstream>      // for ostringstream
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <thread>       // for thread, hardware_concurrency
+#include <utility>      // for move
+#include <vector>       // for vector
+
+namespace adv_sk {
+
+  namespace {
+    /// Rooms per parallel chunk below which a thread costs more than it saves.
+    constexpr std::size_t MIN_CHUNK_ROOMS = 4096;
+    /// Inventories up to this size are checked pairwise, without allocating.
+    constexpr std::size_t SMALL_INVENTORY = 8;
+
+    constexpr std::size_t kind_index(IssueKind kind) {
+      return static_cast<std::size_t>(kind);
+    }
+
+    bool is_exit_issue(IssueKind kind) {
+      return kind == IssueKind::UnknownRoom ||
+             kind == IssueKind::DanglingExit ||
+             kind == IssueKind::ConflictingExit ||
+             kind == IssueKind::OneWayExit;
+    }
+
+    /// Counts every issue but keeps at most `limit` of each kind.
+    class IssueLog {
+     public:
+      explicit IssueLog(std::size_t limit) : _limit(limit) {
+      }
+
+      void add(IssueKind kind, std::string_view room,
+               Direction direction = Direction::North,
+               std::string_view detail = {}) {
+        ++_counts[kind_index(kind)];
+        auto& issues = _issues[kind_index(kind)];
+        if (issues.size() < _limit) {
+          issues.push_back(ValidationIssue{.kind = kind,
+                                           .room = RoomName(room),
+                                           .direction = direction,
+                                           .detail = std::string(detail)});
+        }
+      }
+
+      /// Appends `other` after this log's own issues.
+      void merge(IssueLog&& other) {
+        for (std::size_t kind = 0; kind < ISSUE_KIND_COUNT; ++kind) {
+          _counts[kind] += other._counts[kind];
+          auto& issues = _issues[kind];
+          for (auto& issue : other._issues[kind]) {
+            if (issues.size() == _limit) {
+              break;
+            }
+            issues.push_back(std::move(issue));
+          }
+        }
+      }
+
+      void write_to(ValidationReport& report) && {
+        report.counts = _counts;
+        for (auto& issues : _issues) {
+          std::move(issues.begin(), issues.end(),
+                    std::back_inserter(report.issues));
+        }
+      }
+
+     private:
+      std::size_t _limit;
+      std::array<std::size_t, ISSUE_KIND_COUNT> _counts{};
+      std::array<std::vector<ValidationIssue>, ISSUE_KIND_COUNT> _issues{};
+    };
+
+    void check_items(const Room& room, IssueLog& log) {
+      const auto& items = room.inventory();
+      if (items.size() < 2) {
+        return;
+      }
+      if (items.size() <= SMALL_INVENTORY) {
+        for (std::size_t later = 1; later < items.size(); ++later) {
+          for (std::size_t earlier = 0; earlier < later; ++earlier) {
+            if (items[earlier].name() == items[later].name()) {
+              log.add(IssueKind::DuplicateItem, room.get_name(),
+                      Direction::North, items[later].name());
+              break;
+            }
+          }
+        }
+        return;
+      }
+      std::vector<std::string_view> names;
+      names.reserve(items.size());
+      for (const auto& item : items) {
+        names.emplace_back(item.name());
+      }
+      std::sort(names.begin(), names.end());
+      for (std::size_t index = 1; index < names.size(); ++index) {
+        if (names[index] == names[index - 1]) {
+          log.add(IssueKind::DuplicateItem, room.get_name(), Direction::North,
+                  names[index]);
+        }
+      }
+    }
+
+    /// Reports exits that leave the world or have no matching exit back.
+    template <typename ExitsOf>
+    std::size_t check_exits(std::span<const Room> rooms, RoomId room,
+                            const ExitsOf& exits_of, IssueLog& log) {
+      const auto& exits = exits_of(room);
+      for (const auto direction : exits.directions()) {
+        const auto target = exits.target(direction);
+        if (target >= rooms.size()) {
+          log.add(IssueKind::DanglingExit, rooms[room].get_name(), direction,
+                  "#" + std::to_string(target));
+          continue;
+        }
+        const auto back =
+            exits_of(target).target(opposite_direction(direction));
+        if (back == INVALID_ROOM_ID) {
+          log.add(IssueKind::OneWayExit, rooms[room].get_name(), direction,
+                  rooms[target].get_name());
+        } else if (back != room) {
+          log.add(IssueKind::ConflictingExit, rooms[room].get_name(),
+                  direction, rooms[target].get_name());
+        }
+      }
+      return exits.size();
+    }
+
+    struct ChunkResult {
+      IssueLog log;
+      std::size_t exits{0};
+    };
+
+    /// Runs `check(room, result)` for every room, split over up to `threads`.
+    template <typename Check>
+    ChunkResult check_rooms(std::size_t room_count, std::size_t threads,
+                            std::size_t limit, const Check& check) {
+      if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+      }
+      const auto chunks = std::max<std::size_t>(
+          1, std::min(threads, room_count / MIN_CHUNK_ROOMS));
+      const auto chunk_size = (room_count + chunks - 1) / chunks;
+
+      std::vector<ChunkResult> results(chunks, ChunkResult{IssueLog(limit)});
+      const auto run_chunk = [&](std::size_t chunk) {
+        const auto end = std::min(room_count, (chunk + 1) * chunk_size);
+        for (auto room = chunk * chunk_size; room < end; ++room) {
+          check(static_cast<RoomId>(room), results[chunk]);
+        }
+      };
+      std::vector<std::thread> workers;
+      workers.reserve(chunks - 1);
+      for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        workers.emplace_back(run_chunk, chunk);
+      }
+      run_chunk(0);
+      for (auto& worker : workers) {
+        worker.join();
+      }
+
+      auto total = std::move(results.front());
+      for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        total.log.merge(std::move(results[chunk].log));
+        total.exits += results[chunk].exits;
+      }
+      return total;
+    }
+
+    /// Breadth-first pass from `start`; `ignored` rooms are never reported.
+    template <typename ExitsOf>
+    std::size_t check_reachable(std::span<const Room> rooms, RoomId start,
+                                const ExitsOf& exits_of,
+                                const std::vector<std::uint8_t>& ignored,
+                                IssueLog& log) {
+      std::vector<std::uint8_t> seen(rooms.size(), 0);
+      std::vector<RoomId> queue;
+      queue.reserve(rooms.size());
+      queue.push_back(start);
+      seen[start] = 1;
+      for (std::size_t head = 0; head < queue.size(); ++head) {
+        const auto& exits = exits_of(queue[head]);
+        for (const auto direction : exits.directions()) {
+          const auto target = exits.target(direction);
+          if (target < rooms.size() && seen[target] == 0) {
+            seen[target] = 1;
+            queue.push_back(target);
+          }
+        }
+      }
+      for (RoomId room = 0; room < rooms.size(); ++room) {
+        if (seen[room] == 0 && (ignored.empty() || ignored[room] == 0)) {
+          log.add(IssueKind::UnreachableRoom, rooms[room].get_name());
+        }
+      }
+      return queue.size();
+    }
+
+    /// Claims one exit slot the way the Map links it, reporting a refusal.
+    void claim(std::vector<RoomConnections>& links,
+               const std::vector<Room>& rooms, RoomId room,
+               Direction direction, RoomId target, IssueLog& log) {
+      auto& exits = links[room];
+      if (!exits.contains(direction)) {
+        exits.add(direction, target);
+      } else if (exits.target(direction) != target) {
+        log.add(IssueKind::ConflictingExit, rooms[room].get_name(), direction,
+                rooms[target].get_name());
+      }
+    }
+  }  // namespace
+
+  std::string_view issue_kind_name(IssueKind kind) {
+    switch (kind) {
+      case IssueKind::MissingStartRoom:
+        return "missing start room";
+      case IssueKind::DuplicateRoom:
+        return "duplicate room";
+      case IssueKind::UnknownRoom:
+        return "unknown room";
+      case IssueKind::DanglingExit:
+        return "dangling exit";
+      case IssueKind::ConflictingExit:
+        return "conflicting exit";
+      case IssueKind::OneWayExit:
+        return "one-way exit";
+      case IssueKind::UnreachableRoom:
+        return "unreachable room";
+      case IssueKind::DuplicateItem:
+        return "duplicate item";
+    }
+    return "unknown issue";
+  }
+
+  bool ValidationReport::ok() const {
+    return std::all_of(counts.begin(), counts.end(),
+                       [](std::size_t count) { return count == 0; });
+  }
+
+  std::string ValidationReport::describe() const {
+    std::ostringstream out;
+    std::size_t total = 0;
+    for (const auto count : counts) {
+      total += count;
+    }
+    for (const auto& issue : issues) {
+      out << issue_kind_name(issue.kind) << ": " << issue.room;
+      if (is_exit_issue(issue.kind)) {
+        out << ' ' << direction_to_string(issue.direction);
+      }
+      if (!issue.detail.empty()) {
+        out << " -> " << issue.detail;
+      }
+      out << '\n';
+    }
+    out << rooms << " rooms, " << exits << " exits, " << reachable_rooms
+        << " reachable, " << total << " issues";
+    if (issues.size() < total) {
+      out << " (" << total - issues.size() << " not listed)";
+    }
+    out << '\n';
+    return out.str();
+  }
+
+  ValidationReport validate_world(
+      const std::vector<Room>& rooms,
+      const std::unordered_map<RoomName, NamedConnections>& connections,
+      const ValidationOptions& options) {
+    ValidationReport report;
+    IssueLog log(options.max_issues_per_kind);
+
+    // Room ids are positions in `rooms`; later rooms of a taken name are
+    // ignored, as the Map ignores them.
+    RoomNameIndex index(rooms.size());
+    std::vector<std::uint8_t> ignored(rooms.size(), 0);
+    for (RoomId room = 0; room < rooms.size(); ++room) {
+      if (!index.insert(rooms[room].get_name(), room, rooms)) {
+        ignored[room] = 1;
+        log.add(IssueKind::DuplicateRoom, rooms[room].get_name());
+      }
+    }
+    report.rooms = index.size();
+
+    std::vector<RoomName> unknown_rooms;
+    for (const auto& [room_name, exits] : connections) {
+      if (!index.find(room_name, rooms).has_value()) {
+        unknown_rooms.push_back(room_name);
+      }
+    }
+    std::sort(unknown_rooms.begin(), unknown_rooms.end());
+    for (const auto& room_name : unknown_rooms) {
+      log.add(IssueKind::UnknownRoom, room_name);
+    }
+
+    // Links in room order and direction order, so reports are repeatable.
+    std::vector<RoomConnections> links(rooms.size());
+    for (RoomId room = 0; room < rooms.size(); ++room) {
+      if (ignored[room] != 0) {
+        continue;
+      }
+      const auto found = connections.find(RoomName(rooms[room].get_name()));
+      if (found == connections.end()) {
+        continue;
+      }
+      for (const auto direction : ALL_DIRECTIONS) {
+        const auto exit = found->second.find(direction);
+        if (exit == found->second.end()) {
+          continue;
+        }
+        ++report.exits;
+        const auto target = index.find(exit->second, rooms);
+        if (!target.has_value()) {
+          log.add(IssueKind::DanglingExit, rooms[room].get_name(), direction,
+                  exit->second);
+          continue;
+        }
+        claim(links, rooms, room, direction, target.value(), log);
+        claim(links, rooms, target.value(), opposite_direction(direction),
+              room, log);
+      }
+    }
+
+    const auto exits_of = [&links](RoomId room) -> const RoomConnections& {
+      return links[room];
+    };
+    auto items = check_rooms(
+        rooms.size(), options.threads, options.max_issues_per_kind,
+        [&](RoomId room, ChunkResult& result) {
+          if (ignored[room] == 0) {
+            check_items(rooms[room], result.log);
+          }
+        });
+    log.merge(std::move(items.log));
+
+    const auto start = index.find(options.start_room, rooms);
+    if (start.has_value()) {
+      report.reachable_rooms =
+          check_reachable(rooms, start.value(), exits_of, ignored, log);
+    } else {
+      log.add(IssueKind::MissingStartRoom, options.start_room);
+    }
+    std::move(log).write_to(report);
+    return report;
+  }
+
+  ValidationReport validate_world(std::span<const Room> rooms,
+                                  const ValidationOptions& options) {
+    ValidationReport report;
+    report.rooms = rooms.size();
+    const auto exits_of = [rooms](RoomId room) -> const RoomConnections& {
+      return rooms[room].connections();
+    };
+
+    auto checked = check_rooms(
+        rooms.size(), options.threads, options.max_issues_per_kind,
+        [&](RoomId room, ChunkResult& result) {
+          result.exits += check_exits(rooms, room, exits_of, result.log);
+          check_items(rooms[room], result.log);
+        });
+    report.exits = checked.exits;
+    auto& log = checked.log;
+
+    const auto start = std::find_if(
+        rooms.begin(), rooms.end(), [&options](const Room& room) {
+          return room.get_name() == options.start_room;
+        });
+    if (start != rooms.end()) {
+      report.reachable_rooms = check_reachable(
+          rooms, static_cast<RoomId>(start - rooms.begin()), exits_of, {},
+          log);
+    } else {
+      log.add(IssueKind::MissingStartRoom, options.start_room);
+    }
+    std::move(log).write_to(report);
+    return report;
+  }
+
+  ValidationReport validate_world(const Map& map,
+                                  const ValidationOptions& options) {
+    return validate_world(map.rooms(), options);
+  }
+
+}  // namespace adv_sk
@@ -0,0 +1,108 @@
+//
+// Created by Viktor on 18.10.26.
+//
+
+#pragma once
+
+#include "Direction.hpp"  // for Direction
+#include "Map.hpp"        // for Map
+#include "Room.hpp"       // for Room, NamedConnections
+#include "Types.hpp"      // for RoomName
+
+#include <array>          // for array
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t
+#include <span>           // for span
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+namespace adv_sk {
+
+  enum class IssueKind : std::uint8_t {
+    /// The start room does not exist; reachability is not checked.
+    MissingStartRoom,
+    /// A later room reuses a name; Map keeps the first one.
+    DuplicateRoom,
+    /// Exits are listed for a room that does not exist.
+    UnknownRoom,
+    /// An exit leads to a room that does not exist.
+    DanglingExit,
+    /// Two exits claim the same side of a room.
+    ConflictingExit,
+    /// The target room has no exit leading back.
+    OneWayExit,
+    /// No path leads from the start room to the room.
+    UnreachableRoom,
+    /// Two items of one room share a name; only the first can be taken.
+    DuplicateItem,
+  };
+
+  inline constexpr std::size_t ISSUE_KIND_COUNT = 8;
+
+  [[nodiscard]] std::string_view issue_kind_name(IssueKind kind);
+
+  struct ValidationIssue {
+    IssueKind kind{IssueKind::DanglingExit};
+    RoomName room{};
+    Direction direction{Direction::North};
+    /// The other room or the item involved, when there is one.
+    std::string detail{};
+
+    bool operator==(const ValidationIssue& issue) const = default;
+  };
+
+  struct ValidationOptions {
+    RoomName start_room{"GrandHall"};
+    /// Threads for the per-room checks; 0 means one per core.
+    std::size_t threads{1};
+    /// Issues listed per kind; all of them are still counted.
+    std::size_t max_issues_per_kind{100};
+  };
+
+  struct ValidationReport {
+    std::size_t rooms{0};
+    std::size_t exits{0};
+    std::size_t reachable_rooms{0};
+    std::array<std::size_t, ISSUE_KIND_COUNT> counts{};
+    /// Listed issues, ordered by kind and then by room.
+    std::vector<ValidationIssue> issues{};
+
+    [[nodiscard]] std::size_t count(IssueKind kind) const {
+      return counts[static_cast<std::size_t>(kind)];
+    }
+
+    [[nodiscard]] bool ok() const;
+
+    /// One line per listed issue, then a line of totals.
+    [[nodiscard]] std::string describe() const;
+  };
+
+  /**
+   * @brief Checks authored content before it is handed to the Map.
+   *
+   * Resolves exits the way the Map constructor does, but reports dangling
+   * and conflicting exits instead of throwing or silently keeping the first.
+   * Runs in O(rooms + exits).
+   */
+  ValidationReport validate_world(
+      const std::vector<Room>& rooms,
+      const std::unordered_map<RoomName, NamedConnections>& connections,
+      const ValidationOptions& options = {});
+
+  /**
+   * @brief Checks rooms already linked by RoomId, e.g. generated or loaded.
+   *
+   * Room i has RoomId i. The per-room checks are split over
+   * `options.threads`; reachability is one breadth-first pass. Runs in
+   * O(rooms + exits) and never reads out of bounds, however broken the
+   * links are.
+   */
+  ValidationReport validate_world(std::span<const Room> rooms,
+                                  const ValidationOptions& options = {});
+
+  ValidationReport validate_world(const Map& map,
+                                  const ValidationOptions& options = {});
+
+}  // namespace adv_sk
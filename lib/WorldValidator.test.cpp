@@ -0,0 +1,167 @@
+// WorldValidator unit tests
+
+#include "WorldValidator.hpp"
+
+#include "Direction.hpp"       // for Direction
+#include "Inventory.hpp"       // for InventoryItem
+#include "Map.hpp"             // for Map, create_map
+#include "Room.hpp"            // for Room, NamedConnections
+#include "Types.hpp"           // for RoomName
+#include "WorldGenerator.hpp"  // for generate_map, GeneratorOptions
+#include "gtest/gtest.h"       // for TEST, EXPECT_EQ
+
+#include <cstddef>           // for size_t
+#include <initializer_list>  // for initializer_list
+#include <string>            // for string, to_string
+#include <unordered_map>     // for unordered_map
+#include <vector>            // for vector
+
+namespace adv_sk::test {
+
+  namespace {
+    using Connections = std::unordered_map<RoomName, NamedConnections>;
+
+    std::vector<Room> rooms(std::initializer_list<RoomName> names) {
+      std::vector<Room> result;
+      for (const auto& name : names) {
+        result.emplace_back(name);
+      }
+      return result;
+    }
+  }  // namespace
+
+  TEST(WorldValidator, startingMapIsValid) {
+    const auto report = validate_world(*create_map());
+    EXPECT_TRUE(report.ok()) << report.describe();
+    EXPECT_EQ(report.rooms, 2);
+    EXPECT_EQ(report.exits, 2);
+    EXPECT_EQ(report.reachable_rooms, 2);
+  }
+
+  TEST(WorldValidator, generatedWorldsAreValidOnEveryThreadCount) {
+    for (const auto topology : {Topology::Grid, Topology::Maze,
+                                Topology::RandomGraph, Topology::HubAndSpoke}) {
+      const auto map = generate_map(GeneratorOptions{
+          .topology = topology, .room_count = 20'000, .item_density = 2.0});
+      for (const std::size_t threads : {1, 4}) {
+        const auto report =
+            validate_world(*map, ValidationOptions{.threads = threads});
+        EXPECT_TRUE(report.ok()) << report.describe();
+        EXPECT_EQ(report.reachable_rooms, 20'000);
+      }
+    }
+  }
+
+  TEST(WorldValidator, authoredContentMatchingTheMapIsValid) {
+    const auto report = validate_world(
+        rooms({"GrandHall", "Armoury"}),
+        Connections{{"GrandHall", {{Direction::North, "Armoury"}}},
+                    {"Armoury", {{Direction::South, "GrandHall"}}}});
+    EXPECT_TRUE(report.ok()) << report.describe();
+    EXPECT_EQ(report.exits, 2);
+  }
+
+  TEST(WorldValidator, reportsDanglingExitsInsteadOfThrowing) {
+    const auto report = validate_world(
+        rooms({"GrandHall"}),
+        Connections{{"GrandHall", {{Direction::West, "Nowhere"}}}});
+    ASSERT_EQ(report.count(IssueKind::DanglingExit), 1);
+    EXPECT_EQ(report.issues.front(),
+              (ValidationIssue{.kind = IssueKind::DanglingExit,
+                               .room = "GrandHall",
+                               .direction = Direction::West,
+                               .detail = "Nowhere"}));
+  }
+
+  TEST(WorldValidator, reportsExitsOfUnknownRooms) {
+    const auto report = validate_world(
+        rooms({"GrandHall"}),
+        Connections{{"Attic", {{Direction::South, "GrandHall"}}}});
+    EXPECT_EQ(report.count(IssueKind::UnknownRoom), 1);
+  }
+
+  TEST(WorldValidator, reportsTwoRoomsClaimingTheSameExit) {
+    // Both claim the North of the hall, so both want its South side.
+    const auto report = validate_world(
+        rooms({"GrandHall", "Armoury", "Library"}),
+        Connections{{"Armoury", {{Direction::South, "GrandHall"}}},
+                    {"Library", {{Direction::South, "GrandHall"}}}});
+    ASSERT_EQ(report.count(IssueKind::ConflictingExit), 1);
+    EXPECT_EQ(report.issues.front(),
+              (ValidationIssue{.kind = IssueKind::ConflictingExit,
+                               .room = "GrandHall",
+                               .direction = Direction::North,
+                               .detail = "Library"}));
+  }
+
+  TEST(WorldValidator, reportsDuplicateRoomsAndItems) {
+    std::vector<Room> world{
+        Room("GrandHall", "", {InventoryItem("key"),
+                               InventoryItem("lamp"),
+                               InventoryItem("key")}),
+        Room("GrandHall")};
+    const auto report = validate_world(world, Connections{});
+    EXPECT_EQ(report.count(IssueKind::DuplicateRoom), 1);
+    EXPECT_EQ(report.count(IssueKind::DuplicateItem), 1);
+    EXPECT_EQ(report.count(IssueKind::UnreachableRoom), 0);
+    EXPECT_EQ(report.rooms, 1);
+  }
+
+  TEST(WorldValidator, reportsDuplicateItemsInLargeInventories) {
+    std::vector<InventoryItem> items;
+    for (int item = 0; item < 20; ++item) {
+      items.push_back(
+          InventoryItem("coin" + std::to_string(item % 15)));
+    }
+    const std::vector<Room> world{Room("GrandHall", "", items)};
+    EXPECT_EQ(validate_world(world).count(IssueKind::DuplicateItem), 5);
+  }
+
+  TEST(WorldValidator, reportsUnreachableRooms) {
+    const auto report = validate_world(
+        rooms({"GrandHall", "Armoury", "Cellar", "Crypt"}),
+        Connections{{"GrandHall", {{Direction::North, "Armoury"}}},
+                    {"Cellar", {{Direction::East, "Crypt"}}}});
+    EXPECT_EQ(report.reachable_rooms, 2);
+    ASSERT_EQ(report.count(IssueKind::UnreachableRoom), 2);
+    EXPECT_EQ(report.issues[0].room, "Cellar");
+    EXPECT_EQ(report.issues[1].room, "Crypt");
+  }
+
+  TEST(WorldValidator, reportsMissingStartRoom) {
+    const auto report = validate_world(
+        rooms({"Armoury"}), Connections{},
+        ValidationOptions{.start_room = "GrandHall"});
+    EXPECT_EQ(report.count(IssueKind::MissingStartRoom), 1);
+    EXPECT_EQ(report.count(IssueKind::UnreachableRoom), 0);
+  }
+
+  TEST(WorldValidator, reportsBrokenIdLinksWithoutReadingOutOfBounds) {
+    std::vector<Room> world = rooms({"GrandHall", "Armoury", "Library"});
+    world[0].add_connection(Direction::North, 1);
+    world[1].add_connection(Direction::South, 0);
+    world[2].add_connection(Direction::South, 0);
+    world[0].add_connection(Direction::East, 2);
+    world[1].add_connection(Direction::West, 99);
+    const auto report = validate_world(world);
+    EXPECT_EQ(report.count(IssueKind::DanglingExit), 1);
+    // Library points South at the hall, whose North leads to the Armoury.
+    EXPECT_EQ(report.count(IssueKind::ConflictingExit), 1);
+    // The hall's East leads to the Library, which has no West exit.
+    EXPECT_EQ(report.count(IssueKind::OneWayExit), 1);
+    EXPECT_EQ(report.exits, 5);
+  }
+
+  TEST(WorldValidator, countsEveryIssueButListsOnlyTheLimit) {
+    std::vector<Room> world = rooms({"GrandHall"});
+    for (int room = 0; room < 10; ++room) {
+      world.emplace_back("Room" + std::to_string(room));
+    }
+    const auto report =
+        validate_world(world, ValidationOptions{.max_issues_per_kind = 3});
+    EXPECT_EQ(report.count(IssueKind::UnreachableRoom), 10);
+    EXPECT_EQ(report.issues.size(), 3);
+    EXPECT_NE(report.describe().find("7 not listed"), std::string::npos);
+  }
+
+}  // namespace adv_sk::test
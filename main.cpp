@@ -4,30 +4,137 @@
  *
  */
 
+#include "lib/ActionJournal.hpp"      // for ActionJournal
+#include "lib/BatchInputHandler.hpp"  // for BatchInputHandler
 #include "lib/ConsoleInputHandler.h"
 #include "lib/Game.hpp"
 #include "lib/IInputHandler.hpp"  // for IInputHandler
 #include "lib/IMap.hpp"           // for IMap
 #include "lib/IPlayer.hpp"        // for IPlayer
+#include "lib/ImageMap.hpp"       // for ImageMap
 #include "lib/Map.hpp"            // for create_map
 #include "lib/Player.hpp"         // for Player
+#include "lib/Simulator.hpp"      // for Simulator, OutputMode
+#include "lib/WorldImage.hpp"     // for WorldImage
 
-#include <memory>   // for unique_ptr, make_unique
-#include <utility>  // for move
+#include <cstddef>      // for size_t
+#include <filesystem>   // for path
+#include <iostream>     // for cerr, cout
+#include <exception>    // for exception
+#include <memory>       // for unique_ptr, make_unique
+#include <optional>     // for optional
+#include <span>         // for span
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include <unistd.h>  // for STDIN_FILENO, STDOUT_FILENO
+
+namespace {
+  using adv_sk::Simulator;
+
+  /// The built-in world, or each game's ImageMap over the image at `image`.
+  Simulator::MapFactory make_world(const char* image) {
+    if (image == nullptr) {
+      return [] { return adv_sk::create_map(); };
+    }
+    auto world = adv_sk::WorldImage::open(image);
+    return [world] { return std::make_unique<adv_sk::ImageMap>(world); };
+  }
+
+  /**
+   * @brief Plays one command per line from `input`, "-" being stdin.
+   *
+   * For bots and recorded transcripts: no prompts, buffered output.
+   */
+  int run_batch(std::string_view input, const Simulator::MapFactory& world) {
+    try {
+      auto handler =
+          input == "-"
+              ? std::make_unique<adv_sk::BatchInputHandler>(STDIN_FILENO,
+                                                            STDOUT_FILENO)
+              : std::make_unique<adv_sk::BatchInputHandler>(
+                    std::filesystem::path(input), STDOUT_FILENO);
+      adv_sk::BasicGame<adv_sk::IMap, adv_sk::Player,
+                        adv_sk::BatchInputHandler>
+          game{world(), std::make_unique<adv_sk::Player>(), std::move(handler)};
+      game.start();
+    } catch (const std::exception& error) {
+      std::cerr << error.what() << '\n';
+      return 1;
+    }
+    return 0;
+  }
+
+  /// Replays a journal saved by --record and prints what the game said.
+  int run_replay(const std::filesystem::path& journal,
+                 const Simulator::MapFactory& world) {
+    try {
+      Simulator replay(world, adv_sk::ActionJournal::load(journal).steps(),
+                       adv_sk::OutputMode::Collect);
+      static_cast<void>(replay.run(1));
+      std::cout << replay.transcript();
+    } catch (const std::exception& error) {
+      std::cerr << error.what() << '\n';
+      return 1;
+    }
+    return 0;
+  }
+}  // namespace
 
 /**
  * @brief The main function of the program.
  *
+ * `--batch [file]` plays commands from a file or stdin instead of asking.
+ * `--record <file>` appends the actions of an interactive game to a journal
+ * as they are played and `--replay <file>` plays such a journal back.
+ * Any of them may follow `--world <file.advworld>`, which plays the world
+ * CompileWorld compiled into that image instead of the built-in one.
+ *
  * @return int Returns 0 on successful execution.
  */
-int main() {
-  auto map = adv_sk::create_map();
-  auto player = std::make_unique<adv_sk::Player>();
-  std::unique_ptr<adv_sk::IInputHandler> input =
-      std::make_unique<adv_sk::ConsoleInputHandler>();
-
-  adv_sk::Game game{std::move(map), std::move(player), std::move(input)};
-  game.start();
+int main(int argc, char* argv[]) {
+  auto arguments =
+      std::span<char*>(argv, static_cast<std::size_t>(argc)).subspan(1);
+  const char* image = nullptr;
+  if (arguments.size() > 1 && std::string_view(arguments[0]) == "--world") {
+    image = arguments[1];
+    arguments = arguments.subspan(2);
+  }
+  Simulator::MapFactory world;
+  try {
+    world = make_world(image);
+  } catch (const std::exception& error) {
+    std::cerr << error.what() << '\n';
+    return 1;
+  }
+
+  if (!arguments.empty() && std::string_view(arguments[0]) == "--batch") {
+    return run_batch(arguments.size() > 1 ? arguments[1] : "-", world);
+  }
+  if (arguments.size() > 1 && std::string_view(arguments[0]) == "--replay") {
+    return run_replay(arguments[1], world);
+  }
+
+  // Caught so that the stack unwinds: the journal is written out and closed
+  // however the game ends.
+  try {
+    std::unique_ptr<adv_sk::IInputHandler> input =
+        std::make_unique<adv_sk::ConsoleInputHandler>();
+    adv_sk::Game game{world(), std::make_unique<adv_sk::Player>(),
+                      std::move(input)};
+    std::optional<adv_sk::ActionJournal> journal;
+    if (arguments.size() > 1 && std::string_view(arguments[0]) == "--record") {
+      journal.emplace(adv_sk::ActionJournal::create(arguments[1]));
+      game.set_journal(&journal.value());
+    }
+    game.start();
+    if (journal) {
+      journal->flush();
+    }
+  } catch (const std::exception& error) {
+    std::cerr << error.what() << '\n';
+    return 1;
+  }
 
   return 0;
 }